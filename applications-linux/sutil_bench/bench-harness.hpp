@@ -0,0 +1,150 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-harness.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef BENCH_HARNESS_HPP_
+#define BENCH_HARNESS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sutil_bench
+{
+  /** Keeps the compiler from optimizing away a value that a
+   * benchmark computes but never uses. */
+  template <typename T>
+  inline void doNotOptimize(const T& arg_val)
+  { asm volatile("" : : "r"(&arg_val) : "memory"); }
+
+  /** The result of one benchmark. Times are per operation, in
+   * nanoseconds, over all the timed repetitions. */
+  struct SBenchResult
+  {
+    std::string name_;
+    /** Operations per repetition */
+    std::size_t ops_;
+    /** Timed repetitions */
+    std::size_t reps_;
+    double min_ns_;
+    double median_ns_;
+    double p99_ns_;
+    double max_ns_;
+  };
+
+  /** A small benchmark harness.
+   *
+   * Each benchmark is run arg_warmup times untimed and then
+   * arg_reps times timed. A repetition runs arg_ops operations, and
+   * its time is divided by arg_ops to get the time per operation.
+   *
+   * Usage:
+   *   sutil_bench::CBenchmark bench(3, 31);
+   *   bench.run("map/create", n,
+   *       [&](){ m.clear(); },                      //Untimed setup
+   *       [&](){ for(...) { m.insert(...); } });    //Timed (n ops)
+   *   bench.print(std::cout);
+   *   bench.writeJson(json_file);
+   *
+   * NOTE : Uses std::chrono::steady_clock. The CSystemClock only
+   *        resolves microseconds, which is too coarse here. */
+  class CBenchmark
+  {
+  public:
+    CBenchmark(const std::size_t arg_warmup, const std::size_t arg_reps) :
+      warmup_(arg_warmup), reps_(0==arg_reps ? 1 : arg_reps) {}
+
+    /** Runs a benchmark and records its result. arg_setup is called
+     * (untimed) before every repetition. */
+    template <typename Setup, typename Fn>
+    const SBenchResult& run(const std::string& arg_name, const std::size_t arg_ops,
+        Setup arg_setup, Fn arg_fn)
+    {
+      typedef std::chrono::steady_clock clock;
+      const double ops = static_cast<double>(0==arg_ops ? 1 : arg_ops);
+
+      for(std::size_t i=0; i<warmup_; ++i)
+      { arg_setup(); arg_fn(); }
+
+      std::vector<double> t(reps_);
+      for(std::size_t i=0; i<reps_; ++i)
+      {
+        arg_setup();
+        clock::time_point t1 = clock::now();
+        arg_fn();
+        clock::time_point t2 = clock::now();
+        t[i] = std::chrono::duration<double, std::nano>(t2-t1).count() / ops;
+      }
+      std::sort(t.begin(), t.end());
+
+      SBenchResult res;
+      res.name_ = arg_name;
+      res.ops_ = static_cast<std::size_t>(ops);
+      res.reps_ = reps_;
+      res.min_ns_ = t.front();
+      res.median_ns_ = t[reps_/2];
+      res.p99_ns_ = t[std::min(reps_-1, (reps_*99)/100)];
+      res.max_ns_ = t.back();
+      results_.push_back(res);
+      return results_.back();
+    }
+
+    /** Runs a benchmark that needs no setup */
+    template <typename Fn>
+    const SBenchResult& run(const std::string& arg_name, const std::size_t arg_ops, Fn arg_fn)
+    { return run(arg_name, arg_ops, [](){}, arg_fn); }
+
+    /** Records a result that was measured elsewhere (eg. in another
+     * process) */
+    void add(const SBenchResult& arg_res)
+    { results_.push_back(arg_res); }
+
+    const std::vector<SBenchResult>& getResults() const
+    { return results_; }
+
+    /** Prints a table of the results */
+    void print(std::ostream& ostr) const
+    {
+      std::vector<SBenchResult>::const_iterator it, ite;
+      for(it = results_.begin(), ite = results_.end(); it!=ite; ++it)
+      {
+        ostr<<"\n"<<it->name_<<" : median "<<it->median_ns_<<"ns, p99 "
+            <<it->p99_ns_<<"ns, min "<<it->min_ns_<<"ns ("
+            <<it->ops_<<" ops * "<<it->reps_<<" reps)";
+      }
+    }
+
+    /** Writes the results as a json array (one object per benchmark) */
+    void writeJson(std::ostream& ostr) const
+    {
+      ostr<<"[";
+      std::vector<SBenchResult>::const_iterator it, ite;
+      for(it = results_.begin(), ite = results_.end(); it!=ite; ++it)
+      {
+        ostr<<(it == results_.begin() ? "\n" : ",\n")
+            <<"  {\"name\": \""<<it->name_<<"\", \"ops\": "<<it->ops_
+            <<", \"reps\": "<<it->reps_<<", \"min_ns\": "<<it->min_ns_
+            <<", \"median_ns\": "<<it->median_ns_<<", \"p99_ns\": "<<it->p99_ns_
+            <<", \"max_ns\": "<<it->max_ns_<<"}";
+      }
+      ostr<<"\n]\n";
+    }
+
+  private:
+    std::size_t warmup_;
+    std::size_t reps_;
+    std::vector<SBenchResult> results_;
+  };
+}
+#endif /* BENCH_HARNESS_HPP_ */
@@ -0,0 +1,153 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mapped-tree.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#include "bench-mapped-tree.hpp"
+
+#include <sutil/CMappedTree.hpp>
+#include <sutil/CMappedDirGraph.hpp>
+#include <sutil/CMappedListImage.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <stdio.h>
+
+namespace sutil_bench
+{
+  /** Mapped tree node */
+  struct _benchSMTNode : public sutil::CMappedTree<std::string,_benchSMTNode>::SMTNodeBase
+  { double data_; };
+
+  /** A per-node update loop (eg. a controller's). The tree is passed
+   * by reference to a function that isn't inlined, as it would be in a
+   * real program, so the compiler can't tell its dynamic type unless
+   * the type is final. */
+  template <typename TTree>
+  __attribute__((noinline)) void _benchUpdateNodes(TTree& arg_tree)
+  {
+    for(std::size_t i=0; i<arg_tree.size(); ++i)
+    { arg_tree[i]->data_ += 1.0; }
+  }
+
+  /** Mapped graph node */
+  struct _benchSMGNode : public sutil::CMappedDirGraph<std::string,_benchSMGNode>::SMGNodeBase
+  { double data_; };
+
+  /** A trivially copyable payload (for tree images) */
+  struct _benchImgBody
+  { double mass_; };
+
+  /** A mapped tree node with int indices */
+  struct _benchImgNode
+  {
+    int name_;
+    int parent_name_;
+    _benchImgNode* parent_addr_;
+    std::vector<_benchImgNode*> child_addrs_;
+    _benchImgBody body_;
+    _benchImgNode() : name_(-1), parent_name_(-1), parent_addr_(NULL) {}
+  };
+
+  /** Extracts a tree node's payload for the image */
+  struct _benchImgGetBody
+  {
+    _benchImgBody operator()(const _benchImgNode& arg_node) const
+    { return arg_node.body_; }
+  };
+
+  void bench_mapped_tree(CBenchmark& arg_bench, const std::size_t arg_n)
+  {
+    //Node names (node i's tree parent is node (i-1)/2, ie. a binary tree)
+    std::vector<std::string> names(arg_n);
+    for(std::size_t i=0; i<arg_n; ++i)
+    { std::stringstream ss; ss<<"n"<<i; names[i] = ss.str(); }
+
+    // *************************
+    // Tree : Create the nodes, and link them
+    sutil::CMappedTree<std::string,_benchSMTNode> tree;
+    arg_bench.run("mappedtree/create", arg_n, [&](){ tree.clear(); },
+        [&](){
+      for(std::size_t i=0; i<arg_n; ++i)
+      {
+        _benchSMTNode* node = tree.create(names[i], 0==i);
+        node->name_ = names[i];
+        if(0 < i) { node->parent_name_ = names[(i-1)/2]; }
+      }
+    });
+    arg_bench.run("mappedtree/linkNodes", arg_n,
+        [&](){ if(false == tree.linkNodes()) { throw(std::runtime_error("Could not link the tree")); } });
+
+    // *************************
+    // Update every node through a CMappedTree& (virtual calls) and a
+    // CMappedTreeFinal& (inlined calls)
+    sutil::CMappedTreeFinal<std::string,_benchSMTNode> tree_final;
+    for(std::size_t i=0; i<arg_n; ++i)
+    {
+      _benchSMTNode* node = tree_final.create(names[i], 0==i);
+      node->name_ = names[i];
+      if(0 < i) { node->parent_name_ = names[(i-1)/2]; }
+    }
+    if(false == tree_final.linkNodes())
+    { throw(std::runtime_error("Could not link the final tree")); }
+    sutil::CMappedTree<std::string,_benchSMTNode>& tree_ref = tree;
+    arg_bench.run("mappedtree/update(virtual)", arg_n,
+        [&](){ _benchUpdateNodes(tree_ref); });
+    arg_bench.run("mappedtreefinal/update", arg_n,
+        [&](){ _benchUpdateNodes(tree_final); });
+
+    // *************************
+    // Graph : Each node also has its left neighbour as a (second) parent
+    sutil::CMappedDirGraph<std::string,_benchSMGNode> graph;
+    for(std::size_t i=0; i<arg_n; ++i)
+    {
+      _benchSMGNode* node = graph.create(names[i], 0==i);
+      node->name_ = names[i];
+      if(0 < i)
+      {
+        node->parent_name_ = names[(i-1)/2];
+        node->gr_parent_names_.push_back(names[(i-1)/2]);
+        if(0 < (i-1)/2) { node->gr_parent_names_.push_back(names[(i-1)/2 - 1]); }
+      }
+    }
+    arg_bench.run("mappeddirgraph/linkNodes", arg_n,
+        [&](){ if(false == graph.linkNodes()) { throw(std::runtime_error("Could not link the graph")); } });
+
+    // *************************
+    // Cold start : Rebuild a tree (create() + linkNodes()) vs. map an
+    // image of it
+    const int nimg = static_cast<int>(arg_n);
+    sutil::CMappedTree<int,_benchImgNode> itree;
+    arg_bench.run("mappedtree/create+linkNodes(int)", arg_n, [&](){ itree.clear(); },
+        [&](){
+      for(int i=0; i<nimg; ++i)
+      {
+        _benchImgNode* node = itree.create(i, 0==i);
+        node->name_ = i; node->body_.mass_ = 1.0;
+        if(0 < i) { node->parent_name_ = (i-1)/2; }
+      }
+      if(false == itree.linkNodes()) { throw(std::runtime_error("Could not link the int tree")); }
+    });
+
+    const char* fname = "sutil_bench_image.bin";
+    if(false == sutil::CMappedListImage<int,_benchImgBody>::writeTree(itree, _benchImgGetBody(), fname))
+    { throw(std::runtime_error("Could not write a tree image")); }
+    sutil::CMappedListImage<int,_benchImgBody> timg;
+    arg_bench.run("mappedtreeimage/map", arg_n, [&](){ timg.unmap(); },
+        [&](){
+      if(false == timg.map(fname)) { throw(std::runtime_error("Could not map the tree image")); }
+      doNotOptimize(timg.getRootNode());
+    });
+    timg.unmap();
+    remove(fname);
+  }
+}
@@ -0,0 +1,28 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mapped-tree.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef BENCH_MAPPED_TREE_HPP_
+#define BENCH_MAPPED_TREE_HPP_
+
+#include "bench-harness.hpp"
+
+#include <cstddef>
+
+namespace sutil_bench
+{
+  /** Benchmarks linking mapped trees and graphs, and mapping a tree
+   * image instead of rebuilding the tree
+   * @param arg_bench : Records the results
+   * @param arg_n : The number of elements (or iterations) to use */
+  void bench_mapped_tree(CBenchmark& arg_bench, const std::size_t arg_n);
+}
+#endif /* BENCH_MAPPED_TREE_HPP_ */
@@ -0,0 +1,146 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mappedlist-concurrent.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#include "bench-mappedlist-concurrent.hpp"
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListConcurrent.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sutil_bench
+{
+  typedef sutil::CMappedListConcurrent<int,double> _benchConcList;
+
+  /** Looks up arg_nlookups stable keys (whose value is the key) */
+  static void _benchConcReader(_benchConcList* arg_list, const int arg_nkeys,
+      const std::size_t arg_nlookups, std::atomic<long>* arg_errors)
+  {
+    _benchConcList::CReader rd(*arg_list);
+    if(false == rd.isValid()) { (*arg_errors)++; return; }
+    long err = 0;
+    unsigned int j = 0;
+    for(std::size_t i=0; i<arg_nlookups; ++i)
+    {
+      j = (j*1103515245 + 12345) % static_cast<unsigned int>(arg_nkeys);
+      double v;
+      if(false == rd.get(static_cast<int>(j), v) || v != static_cast<double>(j)) { err++; }
+    }
+    (*arg_errors) += err;
+  }
+
+  /** The same reader, for a mapped list guarded by a mutex */
+  static void _benchLockedReader(sutil::CMappedList<int,double>* arg_list, std::mutex* arg_mutex,
+      const int arg_nkeys, const std::size_t arg_nlookups, std::atomic<long>* arg_errors)
+  {
+    long err = 0;
+    unsigned int j = 0;
+    for(std::size_t i=0; i<arg_nlookups; ++i)
+    {
+      j = (j*1103515245 + 12345) % static_cast<unsigned int>(arg_nkeys);
+      double v = -1.0;
+      {
+        std::lock_guard<std::mutex> lock(*arg_mutex);
+        const double* p = arg_list->at(static_cast<int>(j));
+        if(NULL != p) { v = *p; }
+      }
+      if(v != static_cast<double>(j)) { err++; }
+    }
+    (*arg_errors) += err;
+  }
+
+  /** Creates and erases keys above the stable ones until told to stop,
+   * pausing between changes */
+  static void _benchConcWriter(_benchConcList* arg_list, const int arg_nkeys,
+      std::atomic<bool>* arg_stop)
+  {
+    for(int k = 0; false == arg_stop->load(); ++k)
+    {
+      int key = arg_nkeys + k%64;
+      if(false == arg_list->create(key, -1.0, 0 == k%2))
+      { arg_list->erase(key); }
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+  }
+
+  static void _benchLockedWriter(sutil::CMappedList<int,double>* arg_list, std::mutex* arg_mutex,
+      const int arg_nkeys, std::atomic<bool>* arg_stop)
+  {
+    for(int k = 0; false == arg_stop->load(); ++k)
+    {
+      int key = arg_nkeys + k%64;
+      {
+        std::lock_guard<std::mutex> lock(*arg_mutex);
+        if(NULL == arg_list->create(key, -1.0, 0 == k%2))
+        { arg_list->erase(key); }
+      }
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+  }
+
+  void bench_mappedlist_concurrent(CBenchmark& arg_bench, const std::size_t arg_n)
+  {
+    const int nkeys = 1000;
+    _benchConcList clt;
+    sutil::CMappedList<int,double> mlt;
+    std::mutex mlt_mutex;
+    for(int i=0; i<nkeys; ++i)
+    {
+      clt.create(i, static_cast<double>(i), false);
+      mlt.create(i, static_cast<double>(i), false);
+    }
+
+    // *************************
+    // Lookups with 1, 2, 4 and 8 readers, while a writer runs. The time
+    // per op is the wall time over all the readers' lookups.
+    std::atomic<long> errors(0);
+    const int nreaders[4] = {1, 2, 4, 8};
+    for(int b=0; b<4; ++b)
+    {
+      std::stringstream ss;
+      ss<<" "<<nreaders[b]<<"r+1w";
+      const std::size_t nops = arg_n*static_cast<std::size_t>(nreaders[b]);
+
+      arg_bench.run("concurrent/get"+ss.str(), nops, [&](){
+        std::atomic<bool> stop(false);
+        std::thread wr(_benchConcWriter, &clt, nkeys, &stop);
+        std::vector<std::thread> threads;
+        for(int r=0; r<nreaders[b]; ++r)
+        { threads.push_back(std::thread(_benchConcReader, &clt, nkeys, arg_n, &errors)); }
+        for(std::size_t t=0; t<threads.size(); ++t) { threads[t].join(); }
+        stop.store(true);
+        wr.join();
+        clt.reclaim();
+      });
+
+      arg_bench.run("mutex/at"+ss.str(), nops, [&](){
+        std::atomic<bool> stop(false);
+        std::thread wr(_benchLockedWriter, &mlt, &mlt_mutex, nkeys, &stop);
+        std::vector<std::thread> threads;
+        for(int r=0; r<nreaders[b]; ++r)
+        { threads.push_back(std::thread(_benchLockedReader, &mlt, &mlt_mutex, nkeys, arg_n, &errors)); }
+        for(std::size_t t=0; t<threads.size(); ++t) { threads[t].join(); }
+        stop.store(true);
+        wr.join();
+      });
+    }
+    if(0 != errors.load())
+    { throw(std::runtime_error("Concurrent benchmark readers saw bad values")); }
+  }
+}
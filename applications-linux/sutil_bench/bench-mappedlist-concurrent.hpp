@@ -0,0 +1,28 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mappedlist-concurrent.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef BENCH_MAPPEDLIST_CONCURRENT_HPP_
+#define BENCH_MAPPEDLIST_CONCURRENT_HPP_
+
+#include "bench-harness.hpp"
+
+#include <cstddef>
+
+namespace sutil_bench
+{
+  /** Benchmarks lookups in a concurrent mapped list against a mutex
+   * guarded mapped list, with 1, 2, 4 and 8 readers and one writer
+   * @param arg_bench : Records the results
+   * @param arg_n : The number of lookups each reader does */
+  void bench_mappedlist_concurrent(CBenchmark& arg_bench, const std::size_t arg_n);
+}
+#endif /* BENCH_MAPPEDLIST_CONCURRENT_HPP_ */
@@ -0,0 +1,141 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mappedlist-index.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#include "bench-mappedlist-index.hpp"
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListIndexHash.hpp>
+#include <sutil/CMappedListIndexSmall.hpp>
+#include <sutil/CMappedListIndexDense.hpp>
+#include <sutil/CMappedListRank.hpp>
+#include <sutil/CStringInterner.hpp>
+
+#include <string>
+#include <sstream>
+#include <vector>
+
+namespace sutil_bench
+{
+  /** Looks up arg_nlookups keys (in a scrambled order) */
+  template <typename TList, typename TKey>
+  static void lookupScrambled(TList& arg_list, const std::vector<TKey>& arg_keys,
+      const std::size_t arg_nlookups)
+  {
+    double sum = 0.0;
+    std::size_t n = arg_keys.size(), j = 0;
+    for(std::size_t i=0; i<arg_nlookups; ++i)
+    {
+      j = (j*1103515245 + 12345) % n;
+      sum += *arg_list.at(arg_keys[j]);
+    }
+    doNotOptimize(sum);
+  }
+
+  void bench_mappedlist_index(CBenchmark& arg_bench, const std::size_t arg_n)
+  {
+    std::stringstream ss;
+
+    // *************************
+    // std::map vs. hash index lookups
+    typedef sutil::CMappedList<std::string,double,
+        sutil::CMappedListAllocNew<std::string,double>,
+        sutil::CMappedListIndexHash<std::string,double> > hashlist;
+    const std::size_t sizes[3] = {100, 10000, 1000000};
+    for(int s=0; s<3; ++s)
+    {
+      std::vector<std::string> keys(sizes[s]);
+      for(std::size_t i=0; i<sizes[s]; ++i)
+      { ss.str(""); ss<<"link_"<<i; keys[i] = ss.str(); }
+      ss.str(""); ss<<" "<<sizes[s];
+      const std::string sz = ss.str();
+      {
+        sutil::CMappedList<std::string,double> mlm;
+        for(std::size_t i=0; i<sizes[s]; ++i) { mlm.create(keys[i],1.0); }
+        arg_bench.run("index/std::map/at(string)"+sz, arg_n,
+            [&](){ lookupScrambled(mlm, keys, arg_n); });
+      }
+      {
+        hashlist mlh;
+        for(std::size_t i=0; i<sizes[s]; ++i) { mlh.create(keys[i],1.0); }
+        arg_bench.run("index/hash/at(string)"+sz, arg_n,
+            [&](){ lookupScrambled(mlh, keys, arg_n); });
+      }
+    }
+
+    // *************************
+    // Tiny lists : std::map vs. the inline array (int keys)
+    {
+      const int ntiny = 12;
+      sutil::CMappedList<int,double> mlm;
+      sutil::CMappedList<int,double, sutil::CMappedListAllocNew<int,double>,
+        sutil::CMappedListIndexSmall<int,double> > mlsm;
+      for(int i=0; i<ntiny; ++i) { mlm.create(i*3, 1.0); mlsm.create(i*3, 1.0); }
+      arg_bench.run("index/std::map/at(int) 12", arg_n, [&](){
+        double sum = 0.0;
+        for(std::size_t i=0; i<arg_n; ++i) { sum += *mlm.at(static_cast<int>(i%ntiny)*3); }
+        doNotOptimize(sum);
+      });
+      arg_bench.run("index/small/at(int) 12", arg_n, [&](){
+        double sum = 0.0;
+        for(std::size_t i=0; i<arg_n; ++i) { sum += *mlsm.at(static_cast<int>(i%ntiny)*3); }
+        doNotOptimize(sum);
+      });
+    }
+
+    // *************************
+    // std::string keys (std::map) vs. interned keys (dense index)
+    {
+      const std::size_t nkeys = 1000;
+      std::vector<std::string> skeys(nkeys);
+      std::vector<sutil::SInternedString> ikeys(nkeys);
+      sutil::CMappedList<std::string,double> mls;
+      sutil::CMappedList<sutil::SInternedString,double,
+        sutil::CMappedListAllocNew<sutil::SInternedString,double>,
+        sutil::CMappedListIndexDense<sutil::SInternedString,double> > mld;
+      for(std::size_t i=0; i<nkeys; ++i)
+      {
+        ss.str(""); ss<<"interned_link_"<<i; skeys[i] = ss.str(); ikeys[i] = skeys[i];
+        mls.create(skeys[i],1.0); mld.create(ikeys[i],1.0);
+      }
+      arg_bench.run("index/std::map/at(string) 1000", arg_n,
+          [&](){ lookupScrambled(mls, skeys, arg_n); });
+      arg_bench.run("index/dense/at(interned) 1000", arg_n,
+          [&](){ lookupScrambled(mld, ikeys, arg_n); });
+    }
+
+    // *************************
+    // Positional lookups interleaved with erases : The position cache
+    // (rebuilt after each erase, O(n)) vs. the rank layer (O(log n)).
+    // The setup refills the lists.
+    {
+      const int nrank = 10000;
+      sutil::CMappedList<int,double> mlc;
+      sutil::CMappedList<int,double,sutil::CMappedListAllocNew<int,double>,
+        sutil::CMappedListIndexMap<int,double>, sutil::CMappedListStatsNone,
+        sutil::CMappedListRankFenwick<int,double> > mlf;
+      arg_bench.run("rank/cache/at(size_t)+erase 10000", nrank/2,
+          [&](){ mlc.clear(); for(int i=0; i<nrank; ++i) { mlc.create(i, 1.0, false); } },
+          [&](){
+            double sum = 0.0;
+            for(int i=0; i<nrank/2; ++i) { sum += *mlc.at(mlc.size()/2); mlc.erase(i*2); }
+            doNotOptimize(sum);
+          });
+      arg_bench.run("rank/fenwick/at(size_t)+erase 10000", nrank/2,
+          [&](){ mlf.clear(); for(int i=0; i<nrank; ++i) { mlf.create(i, 1.0, false); } },
+          [&](){
+            double sum = 0.0;
+            for(int i=0; i<nrank/2; ++i) { sum += *mlf.at(mlf.size()/2); mlf.erase(i*2); }
+            doNotOptimize(sum);
+          });
+    }
+  }
+}
@@ -0,0 +1,29 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mappedlist-index.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef BENCH_MAPPEDLIST_INDEX_HPP_
+#define BENCH_MAPPEDLIST_INDEX_HPP_
+
+#include "bench-harness.hpp"
+
+#include <cstddef>
+
+namespace sutil_bench
+{
+  /** Benchmarks the mapped list's index and rank policies against
+   * each other (lookup latency at 100, 10k and 1M entries, tiny lists,
+   * interned keys and positional lookups)
+   * @param arg_bench : Records the results
+   * @param arg_n : The number of lookups (or iterations) to time */
+  void bench_mappedlist_index(CBenchmark& arg_bench, const std::size_t arg_n);
+}
+#endif /* BENCH_MAPPEDLIST_INDEX_HPP_ */
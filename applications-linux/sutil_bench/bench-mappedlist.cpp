@@ -0,0 +1,175 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mappedlist.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#include "bench-mappedlist.hpp"
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListFrozen.hpp>
+
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sutil_bench
+{
+  void bench_mappedlist(CBenchmark& arg_bench, const std::size_t arg_n)
+  {
+    const int n = static_cast<int>(arg_n);
+
+    //Keys in a scrambled order (so lookups don't walk memory in order)
+    std::vector<int> keys(arg_n);
+    for(int i=0; i<n; ++i) { keys[i] = i; }
+    for(int i=n-1, j=0; i>0; --i)
+    {
+      j = static_cast<int>((static_cast<unsigned int>(j)*1103515245u + 12345u) % static_cast<unsigned int>(i+1));
+      std::swap(keys[i], keys[j]);
+    }
+
+    sutil::CMappedList<int,double> ml;
+    std::map<int,double> sm;
+    std::unordered_map<int,double> um;
+    std::vector<double> vec;
+    std::vector<double*> ptrs;
+
+    //The same keys, for bulk loads
+    std::vector<std::pair<int,double> > kv(arg_n);
+    for(int i=0; i<n; ++i) { kv[i] = std::make_pair(keys[i], static_cast<double>(i)); }
+    sutil::CMappedList<int,double> mlrange;
+
+    // *************************
+    // Create
+    arg_bench.run("mappedlist/create", arg_n, [&](){ ml.clear(); },
+        [&](){ for(int i=0; i<n; ++i) { *ml.create(keys[i], false) = i; } });
+    arg_bench.run("mappedlist/createRange", arg_n, [&](){ mlrange.clear(); },
+        [&](){ if(false == mlrange.createRange(kv.begin(), kv.end())) { throw(std::runtime_error("createRange failed")); } });
+    arg_bench.run("std::map/insert", arg_n, [&](){ sm.clear(); },
+        [&](){ for(int i=0; i<n; ++i) { sm[keys[i]] = i; } });
+    arg_bench.run("std::unordered_map/insert", arg_n, [&](){ um.clear(); },
+        [&](){ for(int i=0; i<n; ++i) { um[keys[i]] = i; } });
+    arg_bench.run("std::vector/push_back", arg_n, [&](){ vec.clear(); vec.shrink_to_fit(); },
+        [&](){ for(int i=0; i<n; ++i) { vec.push_back(i); } });
+
+    // *************************
+    // Copy (clones the index instead of re-inserting each key)
+    sutil::CMappedList<int,double> mlcopy;
+    arg_bench.run("mappedlist/copy", arg_n, [&](){ mlcopy.clear(); },
+        [&](){ mlcopy = ml; });
+
+    // *************************
+    // Keyed lookup (the vector is looked up by position)
+    arg_bench.run("mappedlist/at(Idx)", arg_n, [&](){
+      double sum = 0;
+      for(int i=0; i<n; ++i) { sum += *ml.at(keys[i]); }
+      doNotOptimize(sum);
+    });
+    arg_bench.run("std::map/find", arg_n, [&](){
+      double sum = 0;
+      for(int i=0; i<n; ++i) { sum += sm.find(keys[i])->second; }
+      doNotOptimize(sum);
+    });
+    arg_bench.run("std::unordered_map/find", arg_n, [&](){
+      double sum = 0;
+      for(int i=0; i<n; ++i) { sum += um.find(keys[i])->second; }
+      doNotOptimize(sum);
+    });
+    arg_bench.run("std::vector/operator[]", arg_n, [&](){
+      double sum = 0;
+      for(int i=0; i<n; ++i) { sum += vec[keys[i]]; }
+      doNotOptimize(sum);
+    });
+
+    // *************************
+    // Positional lookup (uses the position cache)
+    arg_bench.run("mappedlist/at(size_t)", arg_n, [&](){
+      double sum = 0;
+      for(int i=0; i<n; ++i) { sum += *ml.at(static_cast<std::size_t>(keys[i])); }
+      doNotOptimize(sum);
+    });
+
+    // *************************
+    // Iterate
+    arg_bench.run("mappedlist/iterate", arg_n, [&](){
+      double sum = 0;
+      sutil::CMappedList<int,double>::iterator it, ite;
+      for(it = ml.begin(), ite = ml.end(); it!=ite; ++it) { sum += *it; }
+      doNotOptimize(sum);
+    });
+    arg_bench.run("std::map/iterate", arg_n, [&](){
+      double sum = 0;
+      std::map<int,double>::iterator it, ite;
+      for(it = sm.begin(), ite = sm.end(); it!=ite; ++it) { sum += it->second; }
+      doNotOptimize(sum);
+    });
+    arg_bench.run("std::unordered_map/iterate", arg_n, [&](){
+      double sum = 0;
+      std::unordered_map<int,double>::iterator it, ite;
+      for(it = um.begin(), ite = um.end(); it!=ite; ++it) { sum += it->second; }
+      doNotOptimize(sum);
+    });
+    arg_bench.run("std::vector/iterate", arg_n, [&](){
+      double sum = 0;
+      std::vector<double>::iterator it, ite;
+      for(it = vec.begin(), ite = vec.end(); it!=ite; ++it) { sum += *it; }
+      doNotOptimize(sum);
+    });
+    sutil::CMappedListFrozen<int,double> frozen;
+    if(false == frozen.compile(ml)) { throw(std::runtime_error("Could not compile a frozen snapshot")); }
+    arg_bench.run("mappedlistfrozen/iterate", arg_n, [&](){
+      double sum = 0;
+      for(const double *it = frozen.begin(), *ite = frozen.end(); it!=ite; ++it) { sum += *it; }
+      doNotOptimize(sum);
+    });
+
+    // *************************
+    // Sort with a comparator (the values were created in ascending order)
+    arg_bench.run("mappedlist/sort(comparator)", arg_n,
+        [&](){ mlrange.clear(); mlrange.createRange(kv.begin(), kv.end()); },
+        [&](){ if(false == mlrange.sort(std::greater<double>())) { throw(std::runtime_error("sort failed")); } });
+
+    // *************************
+    // Erase (everything, in the scrambled order). The setup refills
+    // the containers. The vector pops from the back (erasing from its
+    // middle would be O(n) per erase).
+    arg_bench.run("mappedlist/erase(Idx)", arg_n,
+        [&](){ ml.clear(); for(int i=0; i<n; ++i) { *ml.create(keys[i], false) = i; } },
+        [&](){ for(int i=0; i<n; ++i) { ml.erase(keys[i]); } });
+    arg_bench.run("mappedlist/erase(T*)", arg_n,
+        [&](){ ml.clear(); for(int i=0; i<n; ++i) { *ml.create(keys[i], false) = i; }
+               ml.getElementPointers(ptrs); },
+        [&](){ for(int i=0; i<n; ++i) { ml.erase(ptrs[keys[i]]); } });
+    sutil::CMappedList<int,double, sutil::CMappedListAllocNew<int,double>,
+      sutil::CMappedListIndexMap<int,double>, sutil::CMappedListStatsNone,
+      sutil::CMappedListRankNone<int,double>, sutil::CMappedListNodeTableHash<int,double> > mlnt;
+    arg_bench.run("mappedlist/erase(T*) nodetable", arg_n,
+        [&](){ mlnt.clear(); for(int i=0; i<n; ++i) { *mlnt.create(keys[i], false) = i; }
+               mlnt.getElementPointers(ptrs); },
+        [&](){ for(int i=0; i<n; ++i) { mlnt.erase(ptrs[keys[i]]); } });
+    arg_bench.run("mappedlist/erase_if(3 of 4)", arg_n,
+        [&](){ ml.clear(); for(int i=0; i<n; ++i) { *ml.create(keys[i], false) = i; } },
+        [&](){ ml.erase_if([](const double& v){ return 0 != static_cast<int>(v)%4; }); });
+    arg_bench.run("mappedlist/erase(Idx)(3 of 4)", arg_n,
+        [&](){ ml.clear(); for(int i=0; i<n; ++i) { *ml.create(keys[i], false) = i; } },
+        [&](){ for(int i=0; i<n; ++i) { if(0 != i%4) { ml.erase(keys[i]); } } });
+    arg_bench.run("std::map/erase", arg_n,
+        [&](){ sm.clear(); for(int i=0; i<n; ++i) { sm[keys[i]] = i; } },
+        [&](){ for(int i=0; i<n; ++i) { sm.erase(keys[i]); } });
+    arg_bench.run("std::unordered_map/erase", arg_n,
+        [&](){ um.clear(); for(int i=0; i<n; ++i) { um[keys[i]] = i; } },
+        [&](){ for(int i=0; i<n; ++i) { um.erase(keys[i]); } });
+    arg_bench.run("std::vector/pop_back", arg_n,
+        [&](){ vec.assign(arg_n, 1.0); },
+        [&](){ for(int i=0; i<n; ++i) { vec.pop_back(); } });
+  }
+}
@@ -0,0 +1,27 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-mappedlist.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef BENCH_MAPPEDLIST_HPP_
+#define BENCH_MAPPEDLIST_HPP_
+
+#include "bench-harness.hpp"
+
+#include <cstddef>
+
+namespace sutil_bench
+{
+  /** Benchmarks the mapped list against the std containers
+   * @param arg_bench : Records the results
+   * @param arg_n : The number of elements (or iterations) to use */
+  void bench_mappedlist(CBenchmark& arg_bench, const std::size_t arg_n);
+}
+#endif /* BENCH_MAPPEDLIST_HPP_ */
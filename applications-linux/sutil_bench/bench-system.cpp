@@ -0,0 +1,128 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * bench-system.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#include "bench-system.hpp"
+
+#include <sutil/CMemCopier.hpp>
+#include <sutil/CSharedMemory.hpp>
+#include <sutil/CSystemClock.hpp>
+#include <sutil/CRegisteredCallbacks.hpp>
+
+//For fork() and waitpid()
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <sched.h>
+
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <stdexcept>
+
+namespace sutil_bench
+{
+  typedef std::tuple<double> _benchArgType;
+
+  /** A callback that does (almost) nothing, to time the dispatch */
+  class _benchCallbackFunc : public sutil::CCallbackBase<std::string, _benchArgType >
+  {
+    typedef sutil::CCallbackBase<std::string, _benchArgType > base;
+  public:
+    virtual ~_benchCallbackFunc(){}
+
+    virtual void call(_benchArgType& args)
+    { std::get<0>(args) += 1.0; }
+
+    virtual base* createObject()
+    { return dynamic_cast<base*>(new _benchCallbackFunc()); }
+  };
+
+  /** The shared memory's contents (a control loop's command) */
+  struct _benchShmObj
+  { double q_[32]; };
+
+  void bench_system(CBenchmark& arg_bench, const std::size_t arg_n)
+  {
+    // *************************
+    // Memcopier : Copies a double into five buffers
+    double mem = 176.889, buf[5];
+    sutil::CMemCopier<double> mcd;
+    bool flag = mcd.init(&mem);
+    for(int i=0; i<5; ++i) { flag = flag && mcd.addBuf(buf+i); }
+    if(false == flag) { throw(std::runtime_error("Could not initialize the memcopier")); }
+    arg_bench.run("memcopier/copy(5 buffers)", arg_n, [&](){
+      for(std::size_t i=0; i<arg_n; ++i) { mcd.copy(); doNotOptimize(buf[0]); }
+    });
+
+    // *************************
+    // System clock
+    arg_bench.run("systemclock/getSysTime", arg_n, [&](){
+      sutil::suClock t = 0;
+      for(std::size_t i=0; i<arg_n; ++i) { t += sutil::CSystemClock::getSysTime(); }
+      doNotOptimize(t);
+    });
+
+    // *************************
+    // Callbacks : Dispatch by name
+    const std::string cb_name("sutil_bench_callback");
+    if(false == sutil::callbacks::add<_benchCallbackFunc, std::string, _benchArgType>(cb_name))
+    { throw(std::runtime_error("Could not register the callback")); }
+    arg_bench.run("callbacks/call", arg_n, [&](){
+      _benchArgType args(0.0);
+      for(std::size_t i=0; i<arg_n; ++i)
+      { sutil::callbacks::call<std::string,_benchArgType>(cb_name, args); }
+      doNotOptimize(std::get<0>(args));
+    });
+
+    // *************************
+    // Shared memory : Round trip to a child process. The server sets
+    // the signal to 1, the client spins till it sees it and replies 2.
+    // Both yield while spinning so that this works on a single core.
+    sutil::CSharedMemory<_benchShmObj, int> shmem(8090, -1);
+    if(false == shmem.shmCreate())
+    { throw(std::runtime_error("Could not create the shared memory")); }
+    int* sig = shmem.data_signal_;
+    __atomic_store_n(sig, 0, __ATOMIC_SEQ_CST);
+
+    std::cout<<std::flush;
+    pid_t pid_child = fork();
+    if(0 > pid_child)
+    { throw(std::runtime_error("Could not fork a shared memory client")); }
+    if(0 == pid_child)
+    {//Client (inherits the shared memory attachment)
+      while(true)
+      {
+        int s = __atomic_load_n(sig, __ATOMIC_ACQUIRE);
+        if(-1 == s) { break; }
+        if(1 == s)
+        {
+          shmem.data_->q_[0] += 1.0;
+          __atomic_store_n(sig, 2, __ATOMIC_RELEASE);
+        }
+        else { sched_yield(); }
+      }
+      _exit(0);
+    }
+
+    arg_bench.run("sharedmemory/round-trip", arg_n, [&](){
+      for(std::size_t i=0; i<arg_n; ++i)
+      {
+        __atomic_store_n(sig, 1, __ATOMIC_RELEASE);
+        while(2 != __atomic_load_n(sig, __ATOMIC_ACQUIRE)) { sched_yield(); }
+      }
+    });
+
+    //Stop the client (sets the signal to -1) and wait for it
+    shmem.shmDetach();
+    waitpid(pid_child, NULL, 0);
+  }
+}
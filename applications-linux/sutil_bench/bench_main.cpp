@@ -0,0 +1,82 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file bench_main.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#include "bench-harness.hpp"
+#include "bench-mappedlist.hpp"
+#include "bench-mappedlist-index.hpp"
+#include "bench-mappedlist-concurrent.hpp"
+#include "bench-mapped-tree.hpp"
+#include "bench-system.hpp"
+
+#include <sutil/CSystemClock.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <stdlib.h>
+
+using namespace std;
+
+/** This is a benchmark application to time sutil's containers and
+ * utilities, so that releases can be compared.
+ *
+ * Usage : ./sutil_bench [n] [json_file]
+ *   n         : Elements per container (default 10000)
+ *   json_file : Also write the results to this file as json */
+int main(int argc, char** argv)
+{
+  std::size_t n = 10000;
+  if(argc > 1)
+  {
+    int tmp = atoi(argv[1]);
+    if(0 >= tmp)
+    {
+      cout<<"\nUsage : ./sutil_bench [n] [json_file]"
+          <<"\n  n         : Elements per container (default 10000)"
+          <<"\n  json_file : Also write the results to this file as json\n";
+      return 1;
+    }
+    n = static_cast<std::size_t>(tmp);
+  }
+
+  if(false == sutil::CSystemClock::start()) //NOTE: Clock MUST be created and destroyed in main
+  { throw(std::runtime_error("Could not start system clock"));  }
+
+  //Warmup 3 times, time 51 repetitions (so the p99 is the slowest but one)
+  sutil_bench::CBenchmark bench(3, 51);
+  try
+  {
+    cout<<"\nRunning sutil benchmarks with n = "<<n<<flush;
+    sutil_bench::bench_mappedlist(bench, n);
+    sutil_bench::bench_mappedlist_index(bench, n);
+    sutil_bench::bench_mappedlist_concurrent(bench, n);
+    sutil_bench::bench_mapped_tree(bench, n);
+    sutil_bench::bench_system(bench, n);
+  }
+  catch(std::exception& ee)
+  {
+    cout<<"\nBenchmark Error : "<<ee.what()<<"\n";
+    return 1;
+  }
+
+  bench.print(cout);
+  cout<<"\n";
+
+  if(argc > 2)
+  {
+    std::ofstream ofs(argv[2]);
+    if(false == ofs.is_open())
+    { cout<<"\nCould not open json file : "<<argv[2]<<"\n"; return 1; }
+    bench.writeJson(ofs);
+    cout<<"\nWrote json results to : "<<argv[2]<<"\n";
+  }
+  return 0;
+}
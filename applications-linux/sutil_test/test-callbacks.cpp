@@ -14,6 +14,7 @@ See the Readme.txt file in the root folder for licensing information.
 #include <sutil/CSystemClock.hpp>
 
 #include <sutil/CRegisteredCallbacks.hpp>
+#include <sutil/CStringInterner.hpp>
 
 #include <iostream>
 #include <string>
@@ -44,6 +45,23 @@ namespace sutil_test
     { return dynamic_cast<base*>(new CCallbackFunc()); }
   };
 
+  typedef std::tuple<int> CountArgType;
+
+  /** A callback registered under an interned name. Adds one to its arg. */
+  class CCallbackCount : public
+  sutil::CCallbackBase<sutil::SInternedString, CountArgType >
+  {
+    typedef sutil::CCallbackBase<sutil::SInternedString, CountArgType > base;
+  public:
+    virtual ~CCallbackCount(){}
+
+    virtual void call(CountArgType& args)
+    { std::get<0>(args)++; }
+
+    virtual base* createObject()
+    { return dynamic_cast<base*>(new CCallbackCount()); }
+  };
+
   /** Tests the dynamic callback utility
    * @param arg_id : The id of the test */
   void test_callbacks(const int arg_id)
@@ -75,6 +93,21 @@ namespace sutil_test
       sutil::callbacks::call<std::string,ArgType>(callback_name,t);
       std::cout<<"\nTest Result ("<<test_id++<<") Ran callback "<<callback_name;
 
+      //Test 3: Callbacks registered under interned names (looked up by id)
+      sutil::SInternedString count_name("CountFunc");
+      flag = sutil::callbacks::add<CCallbackCount,
+          sutil::SInternedString, CountArgType>(count_name);
+      CountArgType ct(0);
+      for(int i=0; i<10 && flag; ++i)
+      { flag = sutil::callbacks::call<sutil::SInternedString,CountArgType>(count_name,ct); }
+      flag = flag && (10 == std::get<0>(ct)) &&
+          sutil::callbacks::call<sutil::SInternedString,CountArgType>(std::string("CountFunc"),ct) &&
+          (false == sutil::callbacks::call<sutil::SInternedString,CountArgType>("NoFunc",ct));
+      if(false == flag)
+      { throw(std::runtime_error("Failed to run a callback registered under an interned name"));  }
+      else
+      { std::cout<<"\nTest Result ("<<test_id++<<") Ran callback "<<count_name<<" (interned id "<<count_name.id()<<") 11 times"; }
+
       std::cout<<"\nTest #"<<arg_id<<" (Callback Registry Test) Succeeded.";
     }
     catch(std::exception& ee)
@@ -214,6 +214,64 @@ namespace sutil_test
       { throw(std::runtime_error("Node r2 reported to be the descendant of node l1 : Failed")); }
       else { std::cout<<"\nTest Result ("<<test_id++<<") : Node r2 is not the descendant of node l1";  }
 
+      //6. Move the graph. The nodes (and their links) should not move.
+      _testSMGNode *l2 = mgraph.at("l2"), *groot = mgraph.getRootNode();
+      std::size_t nbroken = mgraph.st_broken_edges_.size(), gsz = mgraph.size();
+      sutil::CMappedDirGraph<std::string,_testSMGNode> mgraph2(std::move(mgraph));
+      if( 0 != mgraph.size() || NULL != mgraph.getRootNode() || 0 != mgraph.st_broken_edges_.size() ||
+          gsz != mgraph2.size() || groot != mgraph2.getRootNode() || l2 != mgraph2.at("l2") ||
+          nbroken != mgraph2.st_broken_edges_.size() ||
+          false == mgraph2.isDescendant(mgraph2.at("root"),mgraph2.at("l2")) )
+      { throw(std::runtime_error("Move Graph : Failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") : Moved the graph (nodes and links preserved)";  }
+
+      mgraph = std::move(mgraph2);
+      if( gsz != mgraph.size() || 0 != mgraph2.size() || groot != mgraph.getRootNode() ||
+          l2 != mgraph.at("l2") || NULL == mgraph2.create(node.name_,node,true) )
+      { throw(std::runtime_error("Move Assign Graph : Failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") : Move-assigned the graph";  }
+
+      //7. Clone the graph. All the links should point into the clone.
+      sutil::CMappedDirGraph<std::string,_testSMGNode> mgraph3(mgraph);
+      bool flag = (gsz == mgraph3.size()) && (mgraph3.getRootNode() == mgraph3.at("root")) &&
+          (nbroken == mgraph3.st_broken_edges_.size()) && (l2 != mgraph3.at("l2")) &&
+          mgraph3.isDescendant(mgraph3.at("root"),mgraph3.at("l2"));
+      for(std::size_t i=0; flag && i<mgraph3.st_broken_edges_.size(); ++i)
+      {
+        flag = (mgraph3.st_broken_edges_[i].first == mgraph3.at(mgraph3.st_broken_edges_[i].first->name_)) &&
+            (mgraph3.st_broken_edges_[i].second == mgraph3.at(mgraph3.st_broken_edges_[i].second->name_));
+      }
+      sutil::CMappedDirGraph<std::string,_testSMGNode>::iterator itg,itge;
+      for(itg = mgraph3.begin(), itge = mgraph3.end(); flag && itg!=itge; ++itg)
+      {
+        for(std::size_t i=0; flag && i<itg->gr_parent_addrs_.size(); ++i)
+        { flag = (itg->gr_parent_addrs_[i] == mgraph3.at(itg->gr_parent_addrs_[i]->name_)); }
+        for(std::size_t i=0; flag && i<itg->gr_child_addrs_.size(); ++i)
+        { flag = (itg->gr_child_addrs_[i] == mgraph3.at(itg->gr_child_addrs_[i]->name_)); }
+        flag = flag && (NULL == itg->parent_addr_ || itg->parent_addr_ == mgraph3.at(itg->parent_addr_->name_));
+      }
+      if(false == flag)
+      { throw(std::runtime_error("Clone Graph : Failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") : Cloned the graph (all links point into the clone)";  }
+
+      //8. A final (non-virtual) graph links the same nodes the same way
+      sutil::CMappedDirGraphFinal<std::string,_testSMGNode> fgraph;
+      for(itg = mgraph3.begin(), itge = mgraph3.end(); flag && itg!=itge; ++itg)
+      {
+        node.name_ = itg->name_; node.gr_parent_names_ = itg->gr_parent_names_;
+        flag = (NULL != fgraph.create(node.name_, node, "root" == node.name_));
+      }
+      flag = flag && fgraph.linkNodes() && (gsz == fgraph.size()) &&
+          (nbroken == fgraph.st_broken_edges_.size()) && (fgraph.getRootNode() == fgraph.at("root")) &&
+          fgraph.isDescendant(fgraph.at("root"),fgraph.at("l2")) &&
+          (false == fgraph.isDescendant(fgraph.at("l1"),fgraph.at("r2")));
+      sutil::CMappedDirGraphFinal<std::string,_testSMGNode> fgraph2(fgraph);
+      flag = flag && (gsz == fgraph2.size()) && (fgraph2.at("l2") != fgraph.at("l2")) &&
+          fgraph2.isDescendant(fgraph2.at("root"),fgraph2.at("l2"));
+      if(false == flag)
+      { throw(std::runtime_error("Final Graph : Failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") : Linked and cloned a final (non-virtual) graph";  }
+
       std::cout<<"\nTest #"<<arg_id<<" (Mapped Graph Test) Succeeded.";
     }
     catch (std::exception& ee)
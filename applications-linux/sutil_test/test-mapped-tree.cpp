@@ -12,11 +12,18 @@ See the Readme.txt file in the root folder for licensing information.
 #include "test-mapped-tree.hpp"
 
 #include <sutil/CMappedTree.hpp>
+#include <sutil/CMappedListIndexSecondary.hpp>
+#include <sutil/CMappedListParallel.hpp>
+#include <sutil/CMappedListStats.hpp>
+#include <sutil/CSystemClock.hpp>
 
 #include <iostream>
 #include <string>
+#include <sstream>
+#include <utility>
 #include <stdexcept>
 #include <vector>
+#include <functional>
 #include <stdio.h>
 
 namespace sutil_test
@@ -28,6 +35,49 @@ namespace sutil_test
     int random_data_;
   };
 
+  /** A per-node update that does some work (a few rounds of hashing) */
+  struct _testSMTNodeUpdate
+  {
+    void operator()(_testSMTNode& arg_node) const
+    {
+      unsigned int h = static_cast<unsigned int>(arg_node.random_data_);
+      for(int i=0; i<200; ++i) { h = h*2654435761u + 0x9e3779b9u; h ^= h>>15; }
+      arg_node.random_data_ = static_cast<int>(h & 0xffff);
+    }
+  };
+
+  /** Maps a node to its data (for parallel_reduce) */
+  struct _testSMTNodeData
+  {
+    long operator()(const _testSMTNode& arg_node) const
+    { return static_cast<long>(arg_node.random_data_); }
+  };
+
+  /** Test Structure - Mapped tree Node with a joint id. The tree's
+   * index reads joint_id_, so use the default tree's node base. */
+  struct _testSMTJointNode : public sutil::CMappedTree<std::string,_testSMTJointNode>::SMTNodeBase
+  {
+  public:
+    int joint_id_;
+  };
+
+  /** Reads a node's parent name (a member of the node base, so
+   * CMappedListExtractMember can't point at it) */
+  struct _testSMTParentName
+  {
+    typedef std::string key_type;
+    const std::string& operator()(const _testSMTJointNode& arg_node) const
+    { return arg_node.parent_name_; }
+  };
+
+  /** Finds nodes by name, by joint id (unique) and by parent name */
+  typedef sutil::CMappedListIndexSecondary<std::string, _testSMTJointNode,
+      sutil::CMappedListExtractMember<_testSMTJointNode, int, &_testSMTJointNode::joint_id_>,
+      sutil::CMappedListIndexMap<std::string,_testSMTJointNode>,
+      std::unordered_map<int, sutil::SMLNode<std::string,_testSMTJointNode>*> > _testJointIdIdx;
+  typedef sutil::CMappedListIndexSecondary<std::string, _testSMTJointNode,
+      _testSMTParentName, _testJointIdIdx> _testJointIdx;
+
   /**
    * Tests the mapped tree with the tree:
    *            ground (not a link)
@@ -278,6 +328,245 @@ namespace sutil_test
       for(auto && it : mtree3->getRootNodeConst()->child_addrs_)
       { std::cout<<" "<<it->name_;  }
 
+      // *************************
+      //12. Build a large tree by moving nodes in (no copies)
+      sutil::CMappedTree<std::string,_testSMTNode> mtree4;
+      _testSMTNode mnode;
+      mnode.name_ = "root"; mnode.parent_name_ = "ground";
+      mtree4.create(std::string("root"), std::move(mnode), true);
+      std::stringstream ss;
+      double tstart = sutil::CSystemClock::getSysTime();
+      for(int i=0; i<50000; ++i)
+      {
+        ss.str(""); ss<<"n"<<i;
+        _testSMTNode tmp;
+        tmp.name_ = ss.str(); tmp.parent_name_ = "root";
+        tmp.random_data_ = i;
+        if(NULL == mtree4.create(ss.str(), std::move(tmp), false))
+        { throw(std::runtime_error("Failed to move a node into a mapped tree")); }
+      }
+      double tend = sutil::CSystemClock::getSysTime();
+      if(50001 != mtree4.size() || false == mtree4.linkNodes() ||
+          50000 != mtree4.getRootNode()->child_addrs_.size() ||
+          49999 != mtree4.at("n49999")->random_data_ ||
+          mtree4.at("n7")->parent_addr_ != mtree4.getRootNode())
+      { throw(std::runtime_error("Mapped tree built with moved nodes is incorrect")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Moved 50000 nodes into a mapped tree in "
+          <<tend-tstart<<"s, and linked them";
+
+      // *************************
+      //13. Move and swap the large tree (O(1), the nodes don't move)
+      _testSMTNode *mroot = mtree4.getRootNode(), *n7 = mtree4.at("n7");
+      tstart = sutil::CSystemClock::getSysTime();
+      sutil::CMappedTree<std::string,_testSMTNode> mtree5(std::move(mtree4));
+      tend = sutil::CSystemClock::getSysTime();
+      if(0 != mtree4.size() || NULL != mtree4.getRootNode() || 50001 != mtree5.size() ||
+          mroot != mtree5.getRootNode() || n7 != mtree5.at("n7") || n7->parent_addr_ != mroot)
+      { throw(std::runtime_error("Failed to move a mapped tree")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Moved a 50001 node mapped tree in "<<tend-tstart<<"s";
+
+      mtree4.create(std::string("root"), _testSMTNode(), true);
+      mtree4.swap(mtree5);
+      if(1 != mtree5.size() || 50001 != mtree4.size() || mroot != mtree4.getRootNode() ||
+          mtree5.getRootNode() != mtree5.at("root") || n7 != mtree4.at("n7"))
+      { throw(std::runtime_error("Failed to swap mapped trees")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Swapped mapped trees";
+
+      // *************************
+      //14. Bulk load a tree (one link pass)
+      std::vector<std::pair<std::string,_testSMTNode> > tbulk(1001);
+      tbulk[0].first = "root"; tbulk[0].second.name_ = "root"; tbulk[0].second.parent_name_ = "ground";
+      for(int i=1; i<=1000; ++i)
+      {
+        ss.str(""); ss<<"b"<<i;
+        tbulk[i].first = ss.str(); tbulk[i].second.name_ = ss.str();
+        ss.str(""); ss<<"b"<<i/2;
+        tbulk[i].second.parent_name_ = (1 == i) ? "root" : ss.str();
+        tbulk[i].second.random_data_ = i;
+      }
+      sutil::CMappedTree<std::string,_testSMTNode> mtree6;
+      if(false == mtree6.createRange(tbulk.begin(), tbulk.end(), std::string("root")) ||
+          1001 != mtree6.size() || mtree6.getRootNode() != mtree6.at("root") ||
+          mtree6.at("b999")->parent_addr_ != mtree6.at("b499") ||
+          false == mtree6.isAncestor("b999","b1"))
+      { throw(std::runtime_error("Failed to bulk load a mapped tree")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Bulk loaded and linked a 1001 node mapped tree";
+
+      tbulk.erase(tbulk.begin()+1, tbulk.end());
+      if(mtree6.createRange(tbulk.begin(), tbulk.end(), std::string("root")) ||
+          false == mtree6.assign(tbulk.begin(), tbulk.end(), std::string("root")) ||
+          1 != mtree6.size() || NULL == mtree6.getRootNode())
+      { throw(std::runtime_error("Failed to reject a second root in a bulk load")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Rejected a second root, then re-assigned the tree";
+
+      // *************************
+      //15. Update and sum the large tree's nodes across threads
+      sutil::CMappedTree<std::string,_testSMTNode>::iterator itp, itpe;
+      long sum_serial = 0;
+      mtree4.at("root")->random_data_ = 0;
+      tstart = sutil::CSystemClock::getSysTime();
+      for(itp = mtree4.begin(), itpe = mtree4.end(); itp!=itpe; ++itp)
+      { _testSMTNodeUpdate()(*itp); sum_serial += itp->random_data_; }
+      tend = sutil::CSystemClock::getSysTime();
+      const double tserial = tend-tstart;
+
+      //Undo the update (it is deterministic), then redo it in parallel
+      for(int i=0; i<50000; ++i)
+      { ss.str(""); ss<<"n"<<i; mtree4.at(ss.str())->random_data_ = i; }
+      mtree4.at("root")->random_data_ = 0;
+      tstart = sutil::CSystemClock::getSysTime();
+      sutil::parallel_for_each(mtree4, _testSMTNodeUpdate(), 512);
+      tend = sutil::CSystemClock::getSysTime();
+      long sum_par = sutil::parallel_reduce(mtree4, 0L, _testSMTNodeData(), std::plus<long>(), 512);
+
+      _testSMTNode ref; ref.random_data_ = 49999;
+      _testSMTNodeUpdate()(ref);
+      if(sum_par != sum_serial || ref.random_data_ != mtree4.at("n49999")->random_data_ ||
+          sum_par != sutil::parallel_reduce(mtree4, 0L, _testSMTNodeData(), std::plus<long>(), 1))
+      { throw(std::runtime_error("Parallel for each (or reduce) over a mapped tree gave the wrong result")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Updated 50001 nodes in "<<tend-tstart
+          <<"s in parallel ("<<tserial<<"s serially). Sums match.";
+
+      // *************************
+      //16. Clone the large tree (links are translated, not re-linked by name)
+      tstart = sutil::CSystemClock::getSysTime();
+      sutil::CMappedTree<std::string,_testSMTNode> mtree7(mtree4);
+      tend = sutil::CSystemClock::getSysTime();
+      _testSMTNode *croot = mtree7.getRootNode(), *c7 = mtree7.at("n7");
+      if(50001 != mtree7.size() || NULL == croot || croot != mtree7.at("root") ||
+          croot == mtree4.getRootNode() || c7->parent_addr_ != croot ||
+          50000 != croot->child_addrs_.size() || c7 == mtree4.at("n7") ||
+          croot->child_addrs_[7] != mtree7.at(croot->child_addrs_[7]->name_) ||
+          c7->random_data_ != mtree4.at("n7")->random_data_)
+      { throw(std::runtime_error("Failed to clone a mapped tree")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Cloned a 50001 node mapped tree in "<<tend-tstart<<"s";
+
+      // *************************
+      //17. Count a tree's work with the stats policy
+      sutil::CMappedTree<std::string,_testSMTNode,
+        sutil::CMappedListAllocNew<std::string,_testSMTNode>,
+        sutil::CMappedListIndexMap<std::string,_testSMTNode>,
+        sutil::CMappedListStatsCount> stree;
+      stree.create(std::string("root"), true)->name_ = "root";
+      for(int i=0; i<99; ++i)
+      {
+        ss.str(""); ss<<"s"<<i;
+        _testSMTNode* tmp = stree.create(ss.str(), false);
+        tmp->name_ = ss.str(); tmp->parent_name_ = "root";
+      }
+      const sutil::SMappedListStats& sts = stree.getStats().get();
+      const std::size_t node_bytes = sts.bytes_held_/100;
+      if(100 != sts.creates_ || 100 != sts.allocs_ || 0 != sts.frees_ ||
+          0 == node_bytes || 100*node_bytes != sts.bytes_held_ || false == stree.linkNodes())
+      { throw(std::runtime_error("Stats policy miscounted a tree's creates")); }
+
+      //Positional lookups reuse the position cache (one walk) ...
+      stree.getStats().reset();
+      for(int i=0; i<10; ++i) { stree.at(static_cast<std::size_t>(i)); }
+      bool flag = (10 == sts.pos_lookups_) && (100 >= sts.nodes_walked_) &&
+          (100*node_bytes == sts.bytes_held_) && (0 == sts.creates_);
+      //... unless they are interleaved with erases (O(n) each)
+      const std::size_t walked = sts.nodes_walked_;
+      for(int i=0; i<10; ++i)
+      {
+        ss.str(""); ss<<"s"<<i;
+        stree.erase(ss.str());
+        stree.at(static_cast<std::size_t>(0));
+      }
+      flag = flag && (10 == sts.erases_) && (10 == sts.frees_) && (10 <= sts.lookups_) &&
+          (walked + 99+98+97+96+95+94+93+92+91+90 == sts.nodes_walked_) &&
+          (90*node_bytes == sts.bytes_held_);
+      if(false == flag)
+      { throw(std::runtime_error("Stats policy miscounted a tree's lookups or walks")); }
+
+      if(false == sutil::printables::add("stree_stats", stree.getStats()) ||
+          NULL == sutil::printables::get("stree_stats"))
+      { throw(std::runtime_error("Could not register a tree's stats as a printable")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Counted a tree's work : "
+          <<*sutil::printables::get("stree_stats");
+      sutil::SPrintableBase** pstats = sutil::CRegisteredPrintables::getData()->at(std::string("stree_stats"));
+      delete *pstats;
+      sutil::CRegisteredPrintables::getData()->erase(std::string("stree_stats"));
+
+      // *************************
+      //18. A final (non-virtual) tree behaves like a tree
+      sutil::CMappedTreeFinal<std::string,_testSMTNode> ftree;
+      ftree.create(std::string("root"), true)->name_ = "root";
+      for(int i=0; i<10; ++i)
+      {
+        ss.str(""); ss<<"f"<<i;
+        _testSMTNode* tmp = ftree.create(ss.str(), false);
+        tmp->name_ = ss.str(); tmp->parent_name_ = (0==i) ? "root" : "f0";
+        tmp->random_data_ = i;
+      }
+      flag = ftree.linkNodes() && (11 == ftree.size()) &&
+          (ftree.at("f5")->parent_addr_ == ftree.at("f0")) &&
+          (ftree.at("f0")->parent_addr_ == ftree.getRootNode()) &&
+          ftree.isAncestor("f9", "root");
+      long fsum = 0;
+      for(std::size_t i=0; i<ftree.size(); ++i)
+      { if(ftree[i] != ftree.getRootNode()) { fsum += ftree[i]->random_data_; } }
+      sutil::CMappedTreeFinal<std::string,_testSMTNode> ftree2(ftree);
+      sutil::CMappedTree<std::string,_testSMTNode,
+        sutil::CMappedListAllocNew<std::string,_testSMTNode>,
+        sutil::CMappedListIndexMap<std::string,_testSMTNode>,
+        sutil::CMappedListStatsNone>& ftree_ref = ftree2; //Virtual calls
+      flag = flag && (45 == fsum) && (11 == ftree_ref.size()) &&
+          (ftree2.at("f5")->parent_addr_ == ftree2.at("f0")) &&
+          (ftree2.at("f5") != ftree.at("f5")) && (ftree_ref.at("f5") == ftree2.at("f5"));
+      sutil::CMappedTreeFinal<std::string,_testSMTNode> ftree3(std::move(ftree2));
+      flag = flag && (0 == ftree2.size()) && (11 == ftree3.size()) &&
+          (ftree3.at("f5")->parent_addr_ == ftree3.at("f0")) && ftree3.erase("f9");
+      if(false == flag)
+      { throw(std::runtime_error("A final mapped tree didn't behave like a mapped tree")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Linked, copied and moved a final (non-virtual) mapped tree";
+
+      // *************************
+      //19. Secondary indices : Find nodes by joint id and by parent name
+      sutil::CMappedTree<std::string,_testSMTJointNode,
+        sutil::CMappedListAllocNew<std::string,_testSMTJointNode>, _testJointIdx> jtree;
+      _testSMTJointNode jnode;
+      jnode.name_ = "root"; jnode.parent_name_ = "ground"; jnode.joint_id_ = 0;
+      flag = (NULL != jtree.create(jnode.name_, jnode, true));
+      for(int i=1; i<=20; ++i)
+      {
+        ss.str(""); ss<<"j"<<i;
+        jnode.name_ = ss.str(); jnode.joint_id_ = i*10;
+        jnode.parent_name_ = (i<=5) ? "root" : "j1";
+        flag = flag && (NULL != jtree.create(jnode.name_, jnode, false));
+      }
+      //A repeated joint id is refused (and the tree is unchanged)
+      jnode.name_ = "dup"; jnode.joint_id_ = 50;
+      flag = flag && (NULL == jtree.create(jnode.name_, jnode, false)) && (NULL == jtree.at("dup")) &&
+          (21 == jtree.size()) && (21 == jtree.getIndex().size()) && jtree.linkNodes();
+      const _testJointIdx& jidx = jtree.getIndex();
+      std::pair<_testJointIdx::iterator,_testJointIdx::iterator> jr = jidx.rangeBy("j1");
+      int nchild = 0;
+      for(; jr.first != jr.second; ++jr.first, ++nchild)
+      { flag = flag && (jr.first->parent_addr_ == jtree.at("j1")) && (jtree.at(!jr.first) == &(*jr.first)); }
+      flag = flag && (15 == nchild) && (5 == jidx.countBy("root")) &&
+          (jtree.at("j7") == jidx.getPrimary().findBy(70)) && (NULL == jidx.getPrimary().findBy(75));
+      //Erase, change a key and reindex, copy, clear
+      flag = flag && jtree.erase("j7") && (NULL == jidx.getPrimary().findBy(70)) && (14 == jidx.countBy("j1"));
+      _testSMTJointNode* j8 = jtree.at("j8");
+      j8->joint_id_ = 75; j8->parent_name_ = "root";
+      flag = flag && jtree.reindex(j8) && (j8 == jidx.getPrimary().findBy(75)) &&
+          (NULL == jidx.getPrimary().findBy(80)) && (6 == jidx.countBy("root"));
+      j8->joint_id_ = 90; //Taken by j9 : refused, and j8 keeps 75
+      flag = flag && (false == jtree.reindex(j8)) && (j8 == jidx.getPrimary().findBy(75)) &&
+          (jtree.at("j9") == jidx.getPrimary().findBy(90));
+      j8->joint_id_ = 75;
+      flag = flag && jtree.linkNodes(); //Drops the erased j7 from j1's children
+      sutil::CMappedTree<std::string,_testSMTJointNode,
+        sutil::CMappedListAllocNew<std::string,_testSMTJointNode>, _testJointIdx> jtree2(jtree);
+      flag = flag && (jtree2.at("j8") == jtree2.getIndex().getPrimary().findBy(75)) &&
+          (jtree2.at("j8") != j8) && (6 == jtree2.getIndex().countBy("root")) &&
+          jtree.erase(j8) && (NULL == jidx.getPrimary().findBy(75)) && (NULL != jtree2.at("j8")) &&
+          jtree.clear() && (NULL == jidx.findBy("j1")) && (0 == jidx.countBy("root"));
+      if(false == flag)
+      { throw(std::runtime_error("A tree's secondary indices (joint id, parent name) failed")); }
+      std::cout<<"\nTest Result ("<<test_id++<<") : Found tree nodes by joint id and parent name through secondary indices";
+
       std::cout<<"\nTest #"<<arg_id<<" (Mapped Tree Test) Succeeded.";
     }
     catch (std::exception& ee)
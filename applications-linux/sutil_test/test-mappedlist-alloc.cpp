@@ -0,0 +1,271 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-alloc.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+#include "test-mappedlist-alloc.hpp"
+
+#include <sutil/CSystemClock.hpp>
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListAllocSlab.hpp>
+#include <sutil/CMappedListAllocInline.hpp>
+#include <sutil/CMappedTree.hpp>
+#include <sutil/CMappedMultiLevelList.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+namespace sutil_test
+{
+  /** Test Structure - Mapped tree Node (allocated from a slab) */
+  struct _testSlabNode : public sutil::CMappedTree<std::string,_testSlabNode,
+                                  sutil::CMappedListAllocSlab<std::string,_testSlabNode> >::SMTNodeBase
+  {
+  public:
+    int random_data_;
+  };
+
+  /** Test Structure - Mapped tree Node (stored inline in the list nodes) */
+  struct _testInlineNode : public sutil::CMappedTree<std::string,_testInlineNode,
+                                  sutil::CMappedListAllocInline<std::string,_testInlineNode> >::SMTNodeBase
+  {
+  public:
+    int random_data_;
+  };
+
+  /** Tests the mapped list's node allocation policies
+   * @param arg_id : The id of the test */
+  void test_mappedlist_alloc(const int arg_id)
+  {
+    bool flag = true;
+    unsigned int test_id=0;
+    try
+    {
+      //Timers
+      double time1,time2;
+
+      /** **********************
+       * Slab pool tests
+       * *********************** */
+      sutil::CSlabPool pool(sizeof(double), alignof(double), 4);
+      void *b1 = pool.allocate(), *b2 = pool.allocate();
+      if(NULL == b1 || NULL == b2 || b1 == b2 || 2 != pool.getNumBlocksInUse())
+      { throw(std::runtime_error("Slab pool failed to allocate two blocks")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab pool allocated two blocks"; }
+
+      pool.deallocate(b1);
+      if(b1 != pool.allocate())
+      { throw(std::runtime_error("Slab pool did not reuse a freed block")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab pool reused a freed block"; }
+
+      flag = pool.reserve(100);
+      std::size_t nchunks = pool.getNumChunks();
+      for(int i=0; i<100; ++i) { pool.allocate(); }
+      if(false == flag || nchunks != pool.getNumChunks())
+      { throw(std::runtime_error("Slab pool allocated a chunk after a reserve")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab pool reserve works"; }
+
+      /** **********************
+       * Slab allocated mapped list
+       * *********************** */
+      typedef sutil::CMappedList<std::string,double,
+          sutil::CMappedListAllocSlab<std::string,double> > slablist;
+      slablist ml;
+
+      double *t1, *t2, *t3, *t4 = new double(4.0);
+      t1 = ml.create("t1",1.0);
+      t2 = ml.create("t2",2.0,false);
+      t3 = ml.create("t3",3.0);
+      if(NULL == t1 || NULL == t2 || NULL == t3 || 3 != ml.size() ||
+          *ml.at(0) != 3.0 || *ml.at(1) != 1.0 || *ml.at(2) != 2.0 ||
+          ml.at("t2") != t2)
+      { throw(std::runtime_error("Slab allocated mapped list failed to create nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list created nodes"; }
+
+      if(NULL != ml.create("t1",7.0))
+      { throw(std::runtime_error("Slab allocated mapped list created a duplicate node")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list rejected a duplicate node"; }
+
+      //Adopt a heap pointer (must be deleted, not returned to the pool)
+      if(t4 != ml.insert("t4",t4,false) || ml.at("t4") != t4)
+      { throw(std::runtime_error("Slab allocated mapped list failed to insert a node")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list inserted a node"; }
+
+      flag = ml.erase(t4); t4 = NULL;
+      flag = flag && ml.erase("t2");
+      if(false == flag || 2 != ml.size() || NULL != ml.at("t2") || *ml.at(1) != 1.0)
+      { throw(std::runtime_error("Slab allocated mapped list failed to erase nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list erased nodes"; }
+
+      //Pointer stability : Lots of creates shouldn't move existing nodes
+      std::stringstream ss;
+      for(int i=0; i<5000; ++i)
+      {
+        ss.str(""); ss<<"s"<<i;
+        if(NULL == ml.create(ss.str(),static_cast<double>(i)))
+        { throw(std::runtime_error("Slab allocated mapped list failed to create 5000 nodes")); }
+      }
+      if(ml.at("t1") != t1 || *t1 != 1.0 || ml.at("t3") != t3 || *t3 != 3.0)
+      { throw(std::runtime_error("Slab allocated mapped list moved nodes while growing")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list pointers are stable"; }
+
+      //Erasing and creating again should reuse the freed nodes
+      for(int i=0; i<5000; ++i)
+      { ss.str(""); ss<<"s"<<i; ml.erase(ss.str()); }
+      std::size_t chunks = ml.getAlloc().getNumChunks();
+      time1 = sutil::CSystemClock::getSysTime();
+      for(int i=0; i<5000; ++i)
+      { ss.str(""); ss<<"s"<<i; ml.create(ss.str(),static_cast<double>(i)); }
+      time2 = sutil::CSystemClock::getSysTime();
+      if(chunks != ml.getAlloc().getNumChunks() || 5002 != ml.size())
+      { throw(std::runtime_error("Slab allocated mapped list did not reuse freed nodes")); }
+      else
+      {
+        std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list reused freed nodes."
+            <<" Re-created 5000 nodes in "<<time2-time1<<" seconds";
+      }
+
+      //Copy and swap
+      slablist ml2(ml), ml3;
+      if(ml2 != ml)
+      { throw(std::runtime_error("Slab allocated mapped list copy failed")); }
+      ml3.swap(ml2);
+      if(ml3 != ml || 0 != ml2.size() || 5002 != ml3.getAlloc().getNumNodes())
+      { throw(std::runtime_error("Slab allocated mapped list swap failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list copy and swap work"; }
+
+      flag = ml.clear();
+      if(false == flag || 0 != ml.size() || 0 != ml.getAlloc().getNumNodes())
+      { throw(std::runtime_error("Slab allocated mapped list clear failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped list cleared"; }
+
+      /** **********************
+       * Slab allocated subclasses
+       * *********************** */
+      sutil::CMappedTree<std::string,_testSlabNode,
+        sutil::CMappedListAllocSlab<std::string,_testSlabNode> > mtree;
+      _testSlabNode node;
+      node.name_ = "root"; node.parent_name_ = "ground";
+      mtree.create(node.name_,node,true);
+      node.name_ = "l1"; node.parent_name_ = "root";
+      mtree.create(node.name_,node,false);
+      _testSlabNode* l2 = new _testSlabNode();
+      l2->name_ = "l2"; l2->parent_name_ = "l1";
+      mtree.insert(l2->name_,l2,false);
+      if(false == mtree.linkNodes() || mtree.at("l2") != l2 ||
+          l2->parent_addr_ != mtree.at("l1") ||
+          mtree.at("l1")->parent_addr_ != mtree.getRootNode())
+      { throw(std::runtime_error("Slab allocated mapped tree failed to link nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated mapped tree linked nodes"; }
+
+      sutil::CMappedMultiLevelList<std::string,double,
+        sutil::CMappedListAllocSlab<std::string,double> > mll;
+      mll.create("a",1.0,0); mll.create("b",2.0,2);
+      if(3 != mll.getNumPriorityLevels() || false == mll.erase("b") ||
+          1 != mll.getNumPriorityLevels() || 1.0 != *mll.at("a"))
+      { throw(std::runtime_error("Slab allocated multi-level mapped list failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Slab allocated multi-level mapped list works"; }
+
+      /** **********************
+       * Inline (single block) mapped list
+       * *********************** */
+      typedef sutil::CMappedList<std::string,double,
+          sutil::CMappedListAllocInline<std::string,double> > inlinelist;
+      inlinelist mli;
+      t1 = mli.create("t1",1.0);
+      t2 = mli.create("t2",2.0);
+      t4 = new double(4.0);
+      if(NULL == t1 || NULL == t2 || t4 != mli.insert("t4",t4) ||
+          mli.at("t1") != t1 || 3 != mli.size() || 3 != mli.getAlloc().getNumNodes())
+      { throw(std::runtime_error("Inline mapped list failed to create nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Inline mapped list created and inserted nodes"; }
+
+      //The data and the index must be in the same block
+      flag = true;
+      for(inlinelist::iterator it = mli.begin(), ite = mli.end(); it!=ite; ++it)
+      {
+        if(&(*it) == t4) { continue; } //Adopted data lives outside the block
+        const char *d = reinterpret_cast<const char*>(&(*it)), *i = reinterpret_cast<const char*>(&(!it));
+        std::size_t dist = static_cast<std::size_t>(d < i ? i - d : d - i);
+        if(dist >= mli.getAlloc().getBlockSize()) { flag = false; }
+      }
+      if(false == flag)
+      { throw(std::runtime_error("Inline mapped list stored data outside the node")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Inline mapped list stores data and index in the node"; }
+
+      flag = mli.erase(t4); t4 = NULL;
+      flag = flag && mli.erase("t1");
+      if(false == flag || 1 != mli.size() || *mli.at(0) != 2.0 || 1 != mli.getAlloc().getNumNodes())
+      { throw(std::runtime_error("Inline mapped list failed to erase nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Inline mapped list erased nodes"; }
+
+      //Compare a full sweep with the default layout
+      sutil::CMappedList<std::string,double> mld;
+      mld.create("t2",2.0);
+      for(int i=0; i<50000; ++i)
+      {
+        ss.str(""); ss<<"s"<<i;
+        mli.create(ss.str(),static_cast<double>(i));
+        mld.create(ss.str(),static_cast<double>(i));
+      }
+      double sum_i = 0.0, sum_d = 0.0, time3, time4;
+      time1 = sutil::CSystemClock::getSysTime();
+      for(int r=0; r<20; ++r)
+      {
+        for(inlinelist::iterator it = mli.begin(), ite = mli.end(); it!=ite; ++it)
+        { sum_i += *it; }
+      }
+      time2 = sutil::CSystemClock::getSysTime();
+      time3 = sutil::CSystemClock::getSysTime();
+      for(int r=0; r<20; ++r)
+      {
+        for(sutil::CMappedList<std::string,double>::iterator it = mld.begin(), ite = mld.end(); it!=ite; ++it)
+        { sum_d += *it; }
+      }
+      time4 = sutil::CSystemClock::getSysTime();
+      if(sum_i != sum_d)
+      { throw(std::runtime_error("Inline mapped list sweep gave a different result")); }
+      else
+      {
+        std::cout<<"\nTest Result ("<<test_id++<<") Inline mapped list sweeps. 20x50000 nodes : inline "
+            <<time2-time1<<"s, default "<<time4-time3<<"s";
+      }
+
+      /** **********************
+       * Inline mapped tree
+       * *********************** */
+      sutil::CMappedTree<std::string,_testInlineNode,
+        sutil::CMappedListAllocInline<std::string,_testInlineNode> > itree;
+      _testInlineNode inode;
+      inode.name_ = "root"; inode.parent_name_ = "ground";
+      itree.create(inode.name_,inode,true);
+      inode.name_ = "l1"; inode.parent_name_ = "root";
+      itree.create(inode.name_,inode,false);
+      _testInlineNode* il2 = new _testInlineNode();
+      il2->name_ = "l2"; il2->parent_name_ = "l1";
+      itree.insert(il2->name_,il2,false);
+      if(false == itree.linkNodes() || itree.at("l2") != il2 ||
+          il2->parent_addr_ != itree.at("l1") ||
+          itree.at("l1")->parent_addr_ != itree.getRootNode())
+      { throw(std::runtime_error("Inline mapped tree failed to link nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Inline mapped tree linked nodes"; }
+
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Allocator Test) Succeeded.";
+    }
+    catch(std::exception& ee)
+    {
+      std::cout<<"\nTest Error ("<<test_id++<<") "<<ee.what();
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Allocator Test) Failed";
+    }
+  }
+}
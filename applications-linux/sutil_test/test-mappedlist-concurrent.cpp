@@ -0,0 +1,185 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-concurrent.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+#include "test-mappedlist-concurrent.hpp"
+
+#include <sutil/CMappedListConcurrent.hpp>
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+namespace sutil_test
+{
+  typedef sutil::CMappedListConcurrent<int,double> _testConcList;
+
+  /** Counts the elements visited by forEach */
+  struct _testCountVisits
+  {
+    std::size_t* n_;
+    explicit _testCountVisits(std::size_t* arg_n) : n_(arg_n) {}
+    void operator()(const int& arg_idx, const double& arg_val) const { (*n_)++; }
+  };
+
+  /** Looks up the stable keys (whose value is the key) until told to
+   * stop. Counts lookups and wrong values. */
+  void _testConcReader(_testConcList* arg_list, const int arg_nkeys,
+      std::atomic<bool>* arg_stop, std::atomic<long>* arg_lookups,
+      std::atomic<long>* arg_errors)
+  {
+    _testConcList::CReader rd(*arg_list);
+    if(false == rd.isValid()) { (*arg_errors)++; return; }
+    long n = 0, err = 0;
+    unsigned int j = 0;
+    while(false == arg_stop->load())
+    {
+      for(int i=0; i<256; ++i, ++n)
+      {
+        j = (j*1103515245 + 12345) % static_cast<unsigned int>(arg_nkeys);
+        double v;
+        if(false == rd.get(static_cast<int>(j), v) || v != static_cast<double>(j)) { err++; }
+      }
+      //Every so often, walk the whole list
+      if(0 == n%(256*64))
+      {
+        std::size_t nvisit = 0;
+        if(rd.forEach(_testCountVisits(&nvisit)) < static_cast<std::size_t>(arg_nkeys)) { err++; }
+      }
+    }
+    (*arg_lookups) += n;
+    (*arg_errors) += err;
+  }
+
+  /** Creates, updates and erases keys above the stable ones until
+   * told to stop. */
+  void _testConcWriter(_testConcList* arg_list, const int arg_nkeys,
+      std::atomic<bool>* arg_stop, std::atomic<long>* arg_writes)
+  {
+    long n = 0;
+    for(int k = 0; false == arg_stop->load(); ++k)
+    {
+      int key = arg_nkeys + k%64;
+      if(false == arg_list->create(key, -1.0, 0 == k%2))
+      { arg_list->update(key, -2.0); arg_list->erase(key); }
+      n++;
+    }
+    (*arg_writes) += n;
+  }
+
+  /** Tests the concurrent mapped list
+   * @param arg_id : The id of the test */
+  void test_mappedlist_concurrent(const int arg_id)
+  {
+    bool flag = true;
+    unsigned int test_id=0;
+    try
+    {
+      /** **********************
+       * Single threaded use
+       * *********************** */
+      _testConcList cl;
+      flag = cl.create(1, 1.0) && cl.create(2, 2.0, false) && cl.create(0, 0.0);
+      flag = flag && (false == cl.create(1, 5.0)) && (3 == cl.size());
+      {
+        _testConcList::CReader rd(cl);
+        double v = -1.0;
+        std::size_t nvisit = 0;
+        flag = flag && rd.isValid() && rd.get(2, v) && (2.0 == v) && (false == rd.get(7, v));
+        flag = flag && (3 == rd.forEach(_testCountVisits(&nvisit))) && (3 == nvisit);
+        rd.lock();
+        flag = flag && (NULL != rd.at(0)) && (0.0 == *rd.at(0)) && (NULL == rd.at(3));
+        rd.unlock();
+      }
+      if(false == flag)
+      { throw(std::runtime_error("Concurrent mapped list failed to create and read nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Concurrent mapped list created and read nodes"; }
+
+      flag = cl.update(1, 10.0) && (false == cl.update(9, 1.0)) && cl.erase(0) &&
+          (false == cl.erase(0)) && (2 == cl.size());
+      {
+        _testConcList::CReader rd(cl);
+        double v = -1.0;
+        flag = flag && rd.get(1, v) && (10.0 == v) && (false == rd.get(0, v)) && (2 == rd.size());
+      }
+      cl.reclaim();
+      if(false == flag || 0 != cl.getNumRetired())
+      { throw(std::runtime_error("Concurrent mapped list failed to update and erase nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Concurrent mapped list updated and erased nodes (all retired memory freed)"; }
+
+      {//An active reader holds back reclamation
+        _testConcList::CReader rd(cl);
+        rd.lock();
+        const double* p = rd.at(2);
+        cl.erase(2);
+        flag = (NULL != p) && (2.0 == *p) && (0 < cl.getNumRetired());
+        rd.unlock();
+        cl.reclaim();
+        flag = flag && (0 == cl.getNumRetired());
+      }
+      if(false == flag)
+      { throw(std::runtime_error("Concurrent mapped list freed memory a reader was using")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Concurrent mapped list kept erased nodes alive for a reader"; }
+
+      {//A reader without a slot fails cleanly
+        _testConcList cl1(1);
+        flag = cl1.create(1, 1.0);
+        _testConcList::CReader rd1(cl1), rd2(cl1);
+        double v = -1.0;
+        std::size_t nvisit = 0;
+        flag = flag && rd1.isValid() && (false == rd2.isValid()) && (false == rd2.lock()) &&
+            (NULL == rd2.at(1)) && (false == rd2.get(1, v)) && (0 == rd2.forEach(_testCountVisits(&nvisit)));
+        rd2.unlock();
+        flag = flag && rd1.lock() && (NULL != rd1.at(1));
+        rd1.unlock();
+      }
+      if(false == flag)
+      { throw(std::runtime_error("Concurrent mapped list reader without a slot didn't fail cleanly")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Concurrent mapped list refused reads from a reader without a slot"; }
+
+      /** **********************
+       * Readers and a writer at the same time
+       * *********************** */
+      const int nkeys = 1000;
+      _testConcList clt;
+      for(int i=0; i<nkeys; ++i) { clt.create(i, static_cast<double>(i), false); }
+      {
+        std::atomic<bool> stop(false);
+        std::atomic<long> lookups(0), errors(0), writes(0);
+        std::vector<std::thread> threads;
+        for(int r=0; r<4; ++r)
+        { threads.push_back(std::thread(_testConcReader, &clt, nkeys, &stop, &lookups, &errors)); }
+        threads.push_back(std::thread(_testConcWriter, &clt, nkeys, &stop, &writes));
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        stop.store(true);
+        for(std::size_t t=0; t<threads.size(); ++t) { threads[t].join(); }
+        clt.reclaim();
+        if(0 != errors.load() || 0 == lookups.load() || 0 == writes.load() ||
+            0 != clt.getNumRetired())
+        { throw(std::runtime_error("Concurrent readers saw bad values while a writer ran")); }
+        else
+        {
+          std::cout<<"\nTest Result ("<<test_id++<<") 4 readers did "<<lookups.load()
+              <<" lookups during "<<writes.load()<<" writes. No errors.";
+        }
+      }
+
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Concurrent Test) Succeeded.";
+    }
+    catch(std::exception& ee)
+    {
+      std::cout<<"\nTest Error ("<<test_id++<<") "<<ee.what();
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Concurrent Test) Failed";
+    }
+  }
+}
@@ -0,0 +1,22 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-concurrent.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef TEST_MAPPEDLIST_CONCURRENT_HPP_
+#define TEST_MAPPEDLIST_CONCURRENT_HPP_
+
+namespace sutil_test
+{
+  /** Tests the concurrent mapped list (and benchmarks it against a locked one)
+   * @param arg_id : The id of the test */
+  void test_mappedlist_concurrent(const int arg_id);
+}
+#endif /* TEST_MAPPEDLIST_CONCURRENT_HPP_ */
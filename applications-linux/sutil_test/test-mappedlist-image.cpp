@@ -0,0 +1,210 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-image.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+#include "test-mappedlist-image.hpp"
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedTree.hpp>
+#include <sutil/CMappedListImage.hpp>
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <stdio.h>
+
+namespace sutil_test
+{
+  /** A trivially copyable payload */
+  struct _testImgBody
+  {
+    double mass_;
+    int depth_;
+  };
+
+  /** A mapped tree node with int indices */
+  struct _testImgNode
+  {
+    int name_;
+    int parent_name_;
+    _testImgNode* parent_addr_;
+    std::vector<_testImgNode*> child_addrs_;
+    _testImgBody body_;
+    _testImgNode() : name_(-1), parent_name_(-1), parent_addr_(NULL) {}
+  };
+
+  /** Extracts a tree node's payload for the image */
+  struct _testImgGetBody
+  {
+    _testImgBody operator()(const _testImgNode& arg_node) const
+    { return arg_node.body_; }
+  };
+
+  /** Sums the masses under (and including) a node of a tree image */
+  double _testImgSubtreeMass(const sutil::CMappedListImage<int,_testImgBody>& arg_img,
+      const std::size_t arg_pos)
+  {
+    double m = arg_img.at(arg_pos)->mass_;
+    for(std::size_t i=0; i<arg_img.getNumChildren(arg_pos); ++i)
+    { m += _testImgSubtreeMass(arg_img, static_cast<std::size_t>(arg_img.getChildNumeric(arg_pos, i))); }
+    return m;
+  }
+
+  /** Tests the mapped list (and tree) binary images
+   * @param arg_id : The id of the test */
+  void test_mappedlist_image(const int arg_id)
+  {
+    bool flag = true;
+    unsigned int test_id=0;
+    const char* fname = "sutil_test_image.bin";
+    try
+    {
+      /** **********************
+       * List images
+       * *********************** */
+      sutil::CMappedList<int,_testImgBody> ml;
+      for(int i=0; i<1000; ++i)
+      {
+        _testImgBody b; b.mass_ = 0.5*i; b.depth_ = i%7;
+        ml.create((i*7919)%1000, b, false);
+      }
+      flag = sutil::CMappedListImage<int,_testImgBody>::write(ml, fname);
+      sutil::CMappedListImage<int,_testImgBody> img;
+      flag = flag && img.map(fname) && (1000 == img.size()) && (false == img.isTree());
+      flag = flag && (ml.at(77)->mass_ == img.at(77)->mass_) && (NULL == img.at(1000)) &&
+          (*ml.getIndexAt(5) == *img.getIndexAt(5)) && (img.at(std::size_t(5)) == img.begin()+5) &&
+          (ml.getIndexNumericAt(123) == img.getIndexNumericAt(123));
+      std::size_t pos = 0;
+      sutil::CMappedList<int,_testImgBody>::iterator it, ite;
+      for(it = ml.begin(), ite = ml.end(); flag && it!=ite; ++it, ++pos)
+      { flag = (it->mass_ == img.begin()[pos].mass_) && (it->depth_ == img.begin()[pos].depth_); }
+      if(false == flag)
+      { throw(std::runtime_error("Mapped list image didn't match the list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Wrote and mapped a 1000 element list image"; }
+
+      //Reject images for other types, bad versions and missing files
+      sutil::CMappedListImage<int,double> img_wrong;
+      FILE* fp = fopen(fname, "rb");
+      std::vector<double> buf(1+200000/sizeof(double)); //Aligned storage
+      std::size_t len = fread(&buf[0], 1, buf.size()*sizeof(double), fp);
+      fclose(fp);
+      sutil::CMappedListImage<int,_testImgBody> img2;
+      flag = (false == img_wrong.map(fname)) && img2.view(&buf[0], len) &&
+          (img2.at(77)->mass_ == img.at(77)->mass_);
+      reinterpret_cast<sutil::SMappedListImageHeader*>(&buf[0])->version_ += 1;
+      flag = flag && (false == img2.view(&buf[0], len)) && (false == img2.isValid()) &&
+          (false == img2.map("sutil_test_no_such_file.bin")) && (false == img2.view(&buf[0], len-16));
+      if(false == flag)
+      { throw(std::runtime_error("Mapped list image accepted a bad image")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Rejected images with other types, versions or sizes"; }
+      img.unmap();
+
+      /** **********************
+       * List images with std::string indices (in a string table)
+       * *********************** */
+      sutil::CMappedList<std::string,_testImgBody> mls;
+      for(int i=0; i<500; ++i)
+      {
+        std::stringstream ss; ss<<"body"<<(i*7919)%500;
+        _testImgBody b; b.mass_ = 0.25*i; b.depth_ = i%5;
+        mls.create(ss.str(), b, false);
+      }
+      _testImgBody bempty; bempty.mass_ = -1.0; bempty.depth_ = 0;
+      mls.create("", bempty, false);
+      flag = sutil::CMappedListImage<std::string,_testImgBody>::write(mls, fname);
+      sutil::CMappedListImage<std::string,_testImgBody> simg;
+      flag = flag && simg.map(fname) && (501 == simg.size()) && (false == img2.map(fname));
+      for(std::size_t i=0; flag && i<mls.size(); ++i)
+      {
+        const char* sidx = simg.getIndexAt(i);
+        flag = (NULL != sidx) && (*mls.getIndexAt(i) == sidx) &&
+            (static_cast<int>(i) == simg.getIndexNumericAt(sidx)) &&
+            (mls.at(std::string(sidx))->mass_ == simg.at(i)->mass_);
+      }
+      flag = flag && (NULL == simg.at(std::string("body500"))) && (NULL == simg.at(std::string("bod"))) &&
+          (-1.0 == simg.at(std::string(""))->mass_) && (NULL == simg.getIndexAt(501));
+      if(false == flag)
+      { throw(std::runtime_error("Mapped list image with std::string indices didn't match the list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Wrote and mapped a 501 element list image with std::string indices"; }
+      simg.unmap();
+
+      /** **********************
+       * Tree images
+       * *********************** */
+      const int ntree = 10000;
+      std::vector<int> parent(ntree);
+      std::vector<_testImgBody> bodies(ntree);
+      for(int i=0; i<ntree; ++i)
+      {
+        parent[i] = (0 == i) ? -1 : static_cast<int>((static_cast<unsigned int>(i)*2654435761u)%static_cast<unsigned int>(i));
+        bodies[i].mass_ = 1.0 + i%10; bodies[i].depth_ = (0 == i) ? 0 : bodies[parent[i]].depth_ + 1;
+      }
+
+      sutil::CMappedTree<int,_testImgNode> tree;
+      for(int i=0; i<ntree; ++i)
+      {
+        _testImgNode* n = tree.create(i, 0 == i);
+        if(NULL == n) { throw(std::runtime_error("Could not create a tree node")); }
+        n->name_ = i; n->parent_name_ = parent[i]; n->body_ = bodies[i];
+      }
+      if(false == tree.linkNodes())
+      { throw(std::runtime_error("Could not link the tree")); }
+
+      if(false == sutil::CMappedListImage<int,_testImgBody>::writeTree(tree, _testImgGetBody(), fname))
+      { throw(std::runtime_error("Could not write a tree image")); }
+
+      sutil::CMappedListImage<int,_testImgBody> timg;
+      flag = timg.map(fname);
+      const _testImgBody* troot = timg.getRootNode();
+
+      flag = flag && timg.isTree() && (ntree == static_cast<int>(timg.size())) && (NULL != troot) &&
+          (0 == *timg.getIndexAt(static_cast<std::size_t>(troot - timg.begin())));
+      for(int i=1; flag && i<ntree; i+=997)
+      {
+        int p = timg.getIndexNumericAt(i);
+        flag = (0 <= p) && (parent[i] == *timg.getIndexAt(timg.getParentNumeric(p))) &&
+            (bodies[i].depth_ == timg.at(i)->depth_) &&
+            (tree.at(i)->child_addrs_.size() == timg.getNumChildren(p));
+      }
+      double mass = 0.0;
+      for(int i=0; i<ntree; ++i) { mass += bodies[i].mass_; }
+      flag = flag && (mass == _testImgSubtreeMass(timg, static_cast<std::size_t>(troot - timg.begin())));
+      if(false == flag)
+      { throw(std::runtime_error("Mapped tree image didn't match the tree")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Wrote and mapped a "<<ntree<<" node tree image"; }
+      timg.unmap();
+
+      //Reject a child count whose byte size wraps around
+      fp = fopen(fname, "rb");
+      buf.resize(1+10000000/sizeof(double));
+      len = fread(&buf[0], 1, buf.size()*sizeof(double), fp);
+      fclose(fp);
+      sutil::SMappedListImageHeader* th = reinterpret_cast<sutil::SMappedListImageHeader*>(&buf[0]);
+      flag = timg.view(&buf[0], len);
+      th->n_children_ = (static_cast<std::uint64_t>(1) << 61) + 1; //*8 wraps to 8
+      flag = flag && (false == timg.view(&buf[0], len));
+      if(false == flag)
+      { throw(std::runtime_error("Mapped tree image accepted a wrapping child count")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Rejected a tree image with a wrapping child count"; }
+
+      remove(fname);
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Image Test) Succeeded.";
+    }
+    catch(std::exception& ee)
+    {
+      remove(fname);
+      std::cout<<"\nTest Error ("<<test_id++<<") "<<ee.what();
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Image Test) Failed";
+    }
+  }
+}
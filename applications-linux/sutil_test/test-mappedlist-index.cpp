@@ -0,0 +1,445 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-index.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+#include "test-mappedlist-index.hpp"
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListIndexDense.hpp>
+#include <sutil/CMappedListIndexHash.hpp>
+#include <sutil/CMappedListIndexSecondary.hpp>
+#include <sutil/CMappedListIndexSmall.hpp>
+#include <sutil/CMappedListRank.hpp>
+#include <sutil/CMappedTree.hpp>
+#include <sutil/CMappedMultiLevelList.hpp>
+#include <sutil/CStringInterner.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace sutil_test
+{
+  /** A terrible hash (everything collides) to exercise probing */
+  struct _testCollidingHash
+  {
+    std::size_t operator()(const int& arg_i) const { return 7; }
+  };
+
+  typedef sutil::CMappedListIndexHash<std::string,double> _testStrHashIdx;
+
+  /** Uses the element itself as the secondary key */
+  struct _testExtractValue
+  {
+    typedef int key_type;
+    int operator()(const int& arg_i) const { return arg_i; }
+  };
+
+  /** A list whose values are unique (and ordered) too */
+  typedef sutil::CMappedList<std::string,int, sutil::CMappedListAllocNew<std::string,int>,
+      sutil::CMappedListIndexSecondary<std::string,int,_testExtractValue,
+        sutil::CMappedListIndexMap<std::string,int>,
+        std::map<int, sutil::SMLNode<std::string,int>*> > > _testUniqueValList;
+
+  /** A list with O(log n) positions */
+  typedef sutil::CMappedList<int,double, sutil::CMappedListAllocNew<int,double>,
+      sutil::CMappedListIndexMap<int,double>, sutil::CMappedListStatsNone,
+      sutil::CMappedListRankFenwick<int,double> > _testRankedList;
+
+  /** Checks a ranked list against the order it should have */
+  static bool _testRankMatches(_testRankedList& arg_list, const std::deque<int>& arg_order)
+  {
+    if(arg_list.size() != arg_order.size()) { return false; }
+    const std::size_t n = arg_order.size();
+    _testRankedList::iterator itb = arg_list.begin(), ite = arg_list.end();
+    if(static_cast<std::ptrdiff_t>(n) != ite - itb) { return false; }
+    for(std::size_t i=0; i<n; i += 1 + n/37)
+    {
+      const double* t = arg_list.at(static_cast<std::size_t>(i));
+      if(NULL == t || *t != static_cast<double>(arg_order[i]) ||
+          static_cast<int>(i) != arg_list.getIndexNumericAt(arg_order[i]) ||
+          arg_order[i] != *arg_list.getIndexAt(i) ||
+          *(itb + static_cast<int>(i)) != *t || itb[static_cast<int>(i)] != *t ||
+          *((ite - static_cast<int>(n-i))) != *t ||
+          static_cast<std::ptrdiff_t>(i) != (itb + static_cast<int>(i)) - itb)
+      { return false; }
+    }
+    return true;
+  }
+
+  /** Test Structure - Mapped tree Node (hash indexed) */
+  struct _testHashNode : public sutil::CMappedTree<std::string,_testHashNode,
+                                  sutil::CMappedListAllocNew<std::string,_testHashNode>,
+                                  sutil::CMappedListIndexHash<std::string,_testHashNode> >::SMTNodeBase
+  {
+  public:
+    int random_data_;
+  };
+
+  /** Test Structure - Mapped tree Node (interned names, dense index) */
+  struct _testInternedNode : public sutil::CMappedTree<sutil::SInternedString,_testInternedNode,
+                                  sutil::CMappedListAllocNew<sutil::SInternedString,_testInternedNode>,
+                                  sutil::CMappedListIndexDense<sutil::SInternedString,_testInternedNode> >::SMTNodeBase
+  {
+  public:
+    int random_data_;
+  };
+
+  typedef sutil::CMappedTree<sutil::SInternedString,_testInternedNode,
+      sutil::CMappedListAllocNew<sutil::SInternedString,_testInternedNode>,
+      sutil::CMappedListIndexDense<sutil::SInternedString,_testInternedNode> > _testInternedTree;
+
+  /** Tests the mapped list's index policies
+   * @param arg_id : The id of the test */
+  void test_mappedlist_index(const int arg_id)
+  {
+    bool flag = true;
+    unsigned int test_id=0;
+    try
+    {
+      /** **********************
+       * Hash indexed mapped list
+       * *********************** */
+      typedef sutil::CMappedList<std::string,double,
+          sutil::CMappedListAllocNew<std::string,double>, _testStrHashIdx> hashlist;
+      hashlist ml;
+
+      double *t1, *t2, *t3;
+      t1 = ml.create("t1",1.0);
+      t2 = ml.create("t2",2.0,false);
+      t3 = ml.create("t3",3.0);
+      if(NULL == t1 || NULL == t2 || NULL == t3 || 3 != ml.size() ||
+          3 != ml.getIndex().size() || ml.at("t2") != t2 ||
+          ml.at_const("t3") != t3 || NULL != ml.at("t4") || *ml.at(0) != 3.0)
+      { throw(std::runtime_error("Hash indexed mapped list failed to create nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash indexed mapped list created nodes"; }
+
+      if(NULL != ml.create("t1",7.0) || 3 != ml.size())
+      { throw(std::runtime_error("Hash indexed mapped list created a duplicate node")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash indexed mapped list rejected a duplicate node"; }
+
+      flag = ml.erase("t2");
+      flag = flag && ml.erase(t3);
+      flag = flag && (false == ml.erase("t2"));
+      if(false == flag || 1 != ml.size() || 1 != ml.getIndex().size() ||
+          NULL != ml.at("t2") || NULL != ml.at("t3") || ml.at("t1") != t1)
+      { throw(std::runtime_error("Hash indexed mapped list failed to erase nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash indexed mapped list erased nodes"; }
+
+      //Grow through several rehashes and check every node is still found
+      std::stringstream ss;
+      for(int i=0; i<10000; ++i)
+      { ss.str(""); ss<<"s"<<i; ml.create(ss.str(),static_cast<double>(i)); }
+      flag = (ml.at("t1") == t1);
+      for(int i=0; i<10000 && flag; ++i)
+      {
+        ss.str(""); ss<<"s"<<i;
+        const double *d = ml.at_const(ss.str());
+        flag = (NULL != d && *d == static_cast<double>(i));
+      }
+      if(false == flag || 10001 != ml.size() || ml.getIndex().getCapacity()*3 < ml.size()*4)
+      { throw(std::runtime_error("Hash indexed mapped list lost nodes while growing")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash indexed mapped list grew to 10001 nodes"; }
+
+      //Copy and swap
+      hashlist ml2(ml), ml3;
+      ml3.swap(ml2);
+      if(ml3 != ml || 0 != ml2.size() || NULL != ml2.at("t1") ||
+          NULL == ml3.at("s77") || ml3.at("s77") == ml.at("s77"))
+      { throw(std::runtime_error("Hash indexed mapped list copy and swap failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash indexed mapped list copy and swap work"; }
+
+      flag = ml.clear();
+      if(false == flag || 0 != ml.size() || 0 != ml.getIndex().size() || NULL != ml.at("s1"))
+      { throw(std::runtime_error("Hash indexed mapped list clear failed")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash indexed mapped list cleared"; }
+
+      /** **********************
+       * Probing and erasing with collisions
+       * *********************** */
+      sutil::CMappedList<int,int, sutil::CMappedListAllocNew<int,int>,
+        sutil::CMappedListIndexHash<int,int,_testCollidingHash> > mlc;
+      for(int i=0; i<200; ++i) { mlc.create(i,i); }
+      for(int i=0; i<200; i+=3) { mlc.erase(i); }
+      flag = true;
+      for(int i=0; i<200; ++i)
+      {
+        int *p = mlc.at(i);
+        if(0 == i%3) { flag = flag && (NULL == p); }
+        else { flag = flag && (NULL != p) && (*p == i); }
+      }
+      if(false == flag || 133 != mlc.size())
+      { throw(std::runtime_error("Hash index failed with colliding keys")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash index works with colliding keys"; }
+
+      /** **********************
+       * Small (inline array) index
+       * *********************** */
+      typedef sutil::CMappedList<int,double, sutil::CMappedListAllocNew<int,double>,
+          sutil::CMappedListIndexSmall<int,double,6> > smalllist;
+      smalllist mls;
+      for(int i=0; i<6; ++i) { mls.create(i*7, static_cast<double>(i)); }
+      flag = (6 == mls.getIndex().size()) && (false == mls.getIndex().isBig()) &&
+          (NULL == mls.create(14, 0.0)) && (NULL == mls.at(3));
+      for(int i=0; i<6 && flag; ++i) { flag = (NULL != mls.at(i*7)) && (*mls.at(i*7) == i); }
+      flag = flag && mls.erase(0) && mls.erase(35) && (false == mls.erase(35)) &&
+          (4 == mls.getIndex().size()) && (NULL == mls.at(0)) && (*mls.at(28) == 4.0);
+      if(false == flag)
+      { throw(std::runtime_error("Small indexed mapped list failed to create, find or erase inline")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Small indexed mapped list works inline"; }
+
+      for(int i=100; i<110; ++i) { mls.create(i, static_cast<double>(i)); }
+      flag = (14 == mls.getIndex().size()) && mls.getIndex().isBig() && (*mls.at(21) == 3.0);
+      for(int i=100; i<110 && flag; ++i) { flag = (*mls.at(i) == i); }
+      smalllist mls2(mls), mls3;
+      mls3.swap(mls2);
+      flag = flag && (mls3 == mls) && (0 == mls2.size()) && (NULL == mls2.at(21)) &&
+          (mls3.at(105) != mls.at(105)) && (*mls3.at(105) == 105.0);
+      mls.clear();
+      flag = flag && (false == mls.getIndex().isBig()) && (NULL == mls.at(21));
+      if(false == flag)
+      { throw(std::runtime_error("Small indexed mapped list failed to switch to its big index")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Small indexed mapped list switched to its big index"; }
+
+      sutil::CMappedList<std::string,double, sutil::CMappedListAllocNew<std::string,double>,
+        sutil::CMappedListIndexSmall<std::string,double> > mlss;
+      mlss.create("a",1.0); mlss.create("b",2.0); mlss.create("c",3.0);
+      flag = mlss.erase("a") && (*mlss.at("c") == 3.0) && (*mlss.at("b") == 2.0) &&
+          (NULL == mlss.at("a")) && (2 == mlss.getIndex().size());
+      if(false == flag)
+      { throw(std::runtime_error("Small indexed mapped list failed with string keys")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Small indexed mapped list works with string keys"; }
+
+      /** **********************
+       * Hash indexed mapped tree
+       * *********************** */
+      sutil::CMappedTree<std::string,_testHashNode,
+        sutil::CMappedListAllocNew<std::string,_testHashNode>,
+        sutil::CMappedListIndexHash<std::string,_testHashNode> > mtree;
+      _testHashNode node;
+      node.name_ = "root"; node.parent_name_ = "ground";
+      mtree.create(node.name_,node,true);
+      node.name_ = "l1"; node.parent_name_ = "root";
+      mtree.create(node.name_,node,false);
+      node.name_ = "l2"; node.parent_name_ = "l1";
+      mtree.create(node.name_,node,false);
+      if(false == mtree.linkNodes() ||
+          mtree.at("l2")->parent_addr_ != mtree.at("l1") ||
+          mtree.at("l1")->parent_addr_ != mtree.getRootNode())
+      { throw(std::runtime_error("Hash indexed mapped tree failed to link nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Hash indexed mapped tree linked nodes"; }
+
+      /** **********************
+       * Interned keys and the dense index
+       * *********************** */
+      {
+        sutil::CStringInterner names;
+        sutil::CStringInterner::id_type ida = names.intern("a"), idb = names.intern("b"), idx;
+        flag = (0 != ida) && (ida+1 == idb) && (ida == names.intern("a")) &&
+            (0 == names.intern("")) && (3 == names.size()) && ("b" == *names.name(idb)) &&
+            (NULL == names.name(3)) && names.find("a",idx) && (ida == idx) &&
+            (false == names.find("c",idx));
+        names.clear();
+        flag = flag && (1 == names.size()) && (false == names.find("a",idx)) && (1 == names.intern("b"));
+
+        //Interned keys : equal strings share an id, and print as strings
+        sutil::SInternedString ka("link_a"), ka2(std::string("link_a")), kb("link_b"), ke;
+        ss.str(""); ss<<ka;
+        flag = flag && (ka == ka2) && (ka != kb) && (ka < kb) && (ka.id() == ka2.id()) &&
+            (0 == ke.id()) && ("" == ke.str()) && ("link_a" == ss.str()) &&
+            (static_cast<std::size_t>(kb) == kb.id()) &&
+            (std::hash<sutil::SInternedString>()(kb) == kb.id());
+        if(false == flag)
+        { throw(std::runtime_error("String interning failed")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Interned strings to dense ids"; }
+
+        sutil::CMappedList<sutil::SInternedString,double,
+          sutil::CMappedListAllocNew<sutil::SInternedString,double>,
+          sutil::CMappedListIndexDense<sutil::SInternedString,double> > mld;
+        flag = (NULL != mld.create(ka,1.0)) && (NULL != mld.create("link_b",2.0)) &&
+            (NULL == mld.create(ka2,3.0)) && (2.0 == *mld.at(kb)) && (NULL == mld.at(ke)) &&
+            mld.erase(ka) && (NULL == mld.at(ka)) && (1 == mld.getIndex().size()) &&
+            (NULL != mld.create(ka,4.0)) && (4.0 == *mld.at("link_a"));
+        decltype(mld) mld2(mld), mld3;
+        mld3.swap(mld2);
+        flag = flag && (mld3 == mld) && (NULL == mld2.at(ka)) && (mld3.at(ka) != mld.at(ka)) &&
+            mld.clear() && (NULL == mld.at(kb)) && (0 == mld.getIndex().size());
+        if(false == flag)
+        { throw(std::runtime_error("Dense indexed mapped list failed")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Dense indexed mapped list created, erased, copied and swapped nodes"; }
+
+        //Negative keys have no slot, and a NULL string is the empty one
+        sutil::CMappedList<int,double,sutil::CMappedListAllocNew<int,double>,
+          sutil::CMappedListIndexDense<int,double> > mldi;
+        const char* nullstr = NULL;
+        flag = (NULL == mldi.create(-1,1.0)) && (NULL == mldi.at(-1)) && (false == mldi.erase(-1)) &&
+            (NULL != mldi.create(3,3.0)) && (3.0 == *mldi.at(3)) && (1 == mldi.size()) &&
+            (0 == sutil::SInternedString(nullstr).id());
+        if(false == flag)
+        { throw(std::runtime_error("Dense index accepted a negative key, or interning a NULL string failed")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Dense index refused negative keys, and NULL strings interned as empty"; }
+
+        //A tree linked on integer ids
+        _testInternedTree itree;
+        _testInternedNode inode;
+        inode.name_ = "root"; inode.parent_name_ = "ground";
+        itree.create(inode.name_,inode,true);
+        inode.name_ = "l1"; inode.parent_name_ = "root";
+        itree.create(inode.name_,inode,false);
+        inode.name_ = "l2"; inode.parent_name_ = "l1";
+        itree.create(inode.name_,inode,false);
+        if(false == itree.linkNodes() ||
+            itree.at("l2")->parent_addr_ != itree.at("l1") ||
+            itree.at("l1")->parent_addr_ != itree.getRootNode() ||
+            "l1" != itree.at("l2")->parent_name_.str())
+        { throw(std::runtime_error("Interned mapped tree failed to link nodes")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Interned mapped tree linked nodes"; }
+
+      }
+
+      /** **********************
+       * Secondary index : A unique (ordered) index refuses repeats
+       * *********************** */
+      {
+        _testUniqueValList mlu;
+        flag = (NULL != mlu.create("a",3)) && (NULL != mlu.create("b",1)) &&
+            (NULL == mlu.create("c",3)) && (2 == mlu.size()) && (NULL == mlu.at("c"));
+        int* pi = new int(1);
+        flag = flag && (NULL == mlu.insert("d",pi,true)) && (1 == *pi) && (NULL == mlu.at("d"));
+        delete pi; //Refused, so still ours
+        std::vector<std::pair<std::string,int> > vrange;
+        vrange.push_back(std::make_pair(std::string("e"),5));
+        vrange.push_back(std::make_pair(std::string("f"),1));
+        flag = flag && (false == mlu.createRange(vrange.begin(), vrange.end())) &&
+            (2 == mlu.size()) && (NULL == mlu.at("e")) && (NULL == mlu.getIndex().findBy(5));
+        vrange[1].second = 2;
+        flag = flag && mlu.createRange(vrange.begin(), vrange.end()) && (4 == mlu.size());
+        //The values in order : 1 (b), 2 (f), 3 (a), 5 (e)
+        std::string order;
+        std::map<int, sutil::SMLNode<std::string,int>*>::const_iterator itu;
+        for(itu = mlu.getIndex().getMap().begin(); itu != mlu.getIndex().getMap().end(); ++itu)
+        { order += *(itu->second->id_); }
+        flag = flag && ("bfae" == order) && (mlu.at("f") == mlu.getIndex().findBy(2)) &&
+            mlu.erase("f") && (NULL == mlu.getIndex().findBy(2)) && (NULL != mlu.create("g",2));
+        if(false == flag)
+        { throw(std::runtime_error("Unique secondary index failed to refuse repeated values")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Unique secondary index refused repeated values"; }
+      }
+
+      /** **********************
+       * Rank policy : O(log n) positions while the list changes
+       * *********************** */
+      {
+        _testRankedList mlr;
+        std::deque<int> order; //What the list's order should be
+        unsigned int seed = 17;
+        int next_key = 0;
+        flag = (mlr.begin() == mlr.end()) && (NULL == mlr.at(static_cast<std::size_t>(0)));
+        for(int k=0; k<20000 && flag; ++k)
+        {
+          seed = seed*1103515245 + 12345;
+          const unsigned int r = (seed>>8) % 10;
+          if(r < 3 && 0 < order.size())
+          {//Erase one at a random position
+            const std::size_t pos = (seed>>12) % order.size();
+            flag = mlr.erase(order[pos]);
+            order.erase(order.begin()+pos);
+          }
+          else
+          {
+            const bool front = (r%2 == 0);
+            flag = (NULL != mlr.create(next_key, static_cast<double>(next_key), front));
+            if(front) { order.push_front(next_key); } else { order.push_back(next_key); }
+            next_key++;
+          }
+          if(0 == k%1000) { flag = flag && _testRankMatches(mlr, order); }
+        }
+        flag = flag && _testRankMatches(mlr, order);
+        if(false == flag)
+        { throw(std::runtime_error("Ranked list's positions didn't match after creates and erases")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Ranked list kept its positions over 20000 random creates/erases"; }
+
+        //Iterators : random access, and clamped to [begin, end]
+        _testRankedList::iterator it = mlr.begin();
+        it += 10; it -= 3;
+        _testRankedList::const_iterator cit = static_cast<const _testRankedList&>(mlr).begin();
+        cit = cit + 7;
+        flag = (*it == static_cast<double>(order[7])) && (*cit == *it) &&
+            (mlr.begin() < it) && (false == (it < mlr.begin())) &&
+            (mlr.end() == it + 1000000) && (mlr.begin() == it - 1000000) &&
+            (std::distance(mlr.begin(), mlr.end()) == static_cast<std::ptrdiff_t>(mlr.size())) &&
+            std::is_same<std::iterator_traits<_testRankedList::iterator>::iterator_category,
+                         std::random_access_iterator_tag>::value &&
+            std::is_same<std::iterator_traits<sutil::CMappedList<int,double>::iterator>::iterator_category,
+                         std::forward_iterator_tag>::value;
+        if(false == flag)
+        { throw(std::runtime_error("Ranked list's iterators didn't jump correctly")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Ranked list's iterators are random access"; }
+
+        //Sort, copy and move
+        mlr.sort([](const double& a, const double& b){ return a < b; });
+        std::sort(order.begin(), order.end());
+        _testRankedList mlr2(mlr);
+        flag = _testRankMatches(mlr, order) && _testRankMatches(mlr2, order);
+        _testRankedList mlr3(std::move(mlr2));
+        flag = flag && _testRankMatches(mlr3, order) && (0 == mlr2.size()) && (mlr2.begin() == mlr2.end());
+        flag = flag && mlr3.erase(order[5]) && (NULL != mlr3.create(-1, -1.0));
+        order.erase(order.begin()+5); order.push_front(-1);
+        flag = flag && _testRankMatches(mlr3, order) && mlr3.clear() && (NULL == mlr3.at(static_cast<std::size_t>(0))) &&
+            (NULL != mlr3.create(3, 3.0, false)) && (3.0 == *mlr3.at(static_cast<std::size_t>(0)));
+        if(false == flag)
+        { throw(std::runtime_error("Ranked list's positions were wrong after a sort, copy, move or clear")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Ranked list sorted, copied, moved and cleared"; }
+
+        //The derived containers take a Rank too
+        sutil::CMappedMultiLevelList<int,double, sutil::CMappedListAllocNew<int,double>,
+          sutil::CMappedListIndexMap<int,double>, sutil::CMappedListStatsNone,
+          sutil::CMappedListRankFenwick<int,double> > mlrml;
+        for(int i=0; i<1000; ++i) { mlrml.create(i, static_cast<double>(i), static_cast<std::size_t>(i%3)); }
+        flag = (500 == mlrml.erase_if([](const double& v){ return 0 == static_cast<int>(v)%2; })) &&
+            (500 == mlrml.size()) && (167 == mlrml.getSinglePriorityLevel(0)->size()) &&
+            (167 == mlrml.getSinglePriorityLevel(1)->size()) && (166 == mlrml.getSinglePriorityLevel(2)->size());
+        for(std::size_t i=0; flag && i<500; i+=7) //Creates insert at the front
+        { flag = (static_cast<double>(999-2*i) == *mlrml.at(i)) && (mlrml.at(i) == &*(mlrml.begin()+i)); }
+
+        sutil::CMappedTree<std::string,_testHashNode,
+          sutil::CMappedListAllocNew<std::string,_testHashNode>,
+          sutil::CMappedListIndexMap<std::string,_testHashNode>, sutil::CMappedListStatsNone,
+          sutil::CMappedListRankFenwick<std::string,_testHashNode>,
+          sutil::CMappedListNodeTableHash<std::string,_testHashNode> > mlrtree;
+        node.name_ = "root"; node.parent_name_ = "ground";
+        mlrtree.create(node.name_,node,true);
+        node.name_ = "l1"; node.parent_name_ = "root";
+        mlrtree.create(node.name_,node,false);
+        node.name_ = "l2"; node.parent_name_ = "l1";
+        mlrtree.create(node.name_,node,false);
+        flag = flag && mlrtree.linkNodes() && (mlrtree.at("l2")->parent_addr_ == mlrtree.at("l1")) &&
+            (mlrtree.at(static_cast<std::size_t>(0)) == mlrtree.at("l2")) &&
+            (2 == mlrtree.getIndexNumericAt(mlrtree.getRootNode()));
+        if(false == flag)
+        { throw(std::runtime_error("Ranked multi-level list or node tabled tree had wrong positions")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Ranked multi-level list and node tabled tree found positions"; }
+
+      }
+
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Index Test) Succeeded.";
+    }
+    catch(std::exception& ee)
+    {
+      std::cout<<"\nTest Error ("<<test_id++<<") "<<ee.what();
+      std::cout<<"\nTest #"<<arg_id<<" (Mapped List Index Test) Failed";
+    }
+  }
+}
@@ -0,0 +1,194 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-shared.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+#include "test-mappedlist-shared.hpp"
+
+#include <sutil/CMappedListShared.hpp>
+#include <sutil/CSharedMemory.hpp>
+
+//For fork() and usleep()
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <stdexcept>
+#include <cstring>
+#include <cstdlib>
+#include <type_traits>
+
+namespace sutil_test
+{
+  /** A trivially copyable payload */
+  struct _testShmBody
+  {
+    double mass_;
+    int id_;
+    char name_[16];
+  };
+
+  typedef sutil::CMappedListShared<int,_testShmBody,4096> _testShmList;
+
+  /** Raw memory for a list, as a shared memory segment would hold it */
+  typedef std::aligned_storage<sizeof(_testShmList), alignof(_testShmList)>::type _testShmSegment;
+
+  /** Fills a list with arg_n bodies (keys 0..arg_n-1), and erases every
+   * 7th one */
+  bool _testShmFill(_testShmList& arg_list, const int arg_n)
+  {
+    arg_list.init();
+    for(int i=0; i<arg_n; ++i)
+    {
+      _testShmBody b; b.mass_ = 0.25*i; b.id_ = i;
+      std::memset(b.name_, 0, sizeof(b.name_));
+      std::strncpy(b.name_, "body", sizeof(b.name_)-1);
+      b.name_[4] = static_cast<char>('a' + i%26);
+      if(NULL == arg_list.create(i, b, false)) { return false; }
+    }
+    for(int i=0; i<arg_n; i+=7)
+    { if(false == arg_list.erase(i)) { return false; } }
+    return true;
+  }
+
+  /** Checks a list filled by _testShmFill() (lookups and order) */
+  bool _testShmCheck(const _testShmList& arg_list, const int arg_n)
+  {
+    if(false == arg_list.isInit() || arg_list.size() != static_cast<std::size_t>(arg_n - (arg_n+6)/7))
+    { return false; }
+    for(int i=0; i<arg_n; ++i)
+    {
+      const _testShmBody* b = arg_list.at(i);
+      if(0 == i%7) { if(NULL != b) { return false; } continue; }
+      if(NULL == b || b->id_ != i || b->mass_ != 0.25*i ||
+          b->name_[4] != static_cast<char>('a' + i%26) || *arg_list.getIndex(b) != i)
+      { return false; }
+    }
+    int prev = -1;
+    _testShmList::const_iterator it,ite;
+    for(it = arg_list.begin(), ite = arg_list.end(); it!=ite; ++it)
+    {
+      if(it->id_ <= prev || (!it) != it->id_) { return false; }
+      prev = it->id_;
+    }
+    return true;
+  }
+
+  /** Tests the shared memory mapped list
+   * @param arg_id : The id of the test */
+  void test_mappedlist_shared(const int arg_id)
+  {
+    bool flag = true;
+    unsigned int test_id=0;
+    pid_t pid_child = 1;
+    const int n = 3000;
+    try
+    {
+      /** **********************
+       * Relocation : Build a list in a segment, copy the segment's bytes
+       * elsewhere and use the copy (as another process's mapping would)
+       * *********************** */
+      _testShmSegment *sega = new _testShmSegment(), *segb = new _testShmSegment();
+      _testShmList *la = reinterpret_cast<_testShmList*>(sega);
+      flag = _testShmFill(*la, n);
+      std::memcpy(static_cast<void*>(segb), static_cast<const void*>(sega), sizeof(_testShmSegment));
+      std::memset(static_cast<void*>(sega), 0xab, sizeof(_testShmSegment)); //Scribble over the original
+      delete sega;
+      _testShmList *lb = reinterpret_cast<_testShmList*>(segb);
+      flag = flag && _testShmCheck(*lb, n);
+      if(false == flag)
+      { delete segb; throw(std::runtime_error("A relocated shared list didn't match the original")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Relocated a "<<lb->size()<<" element list by copying its segment"; }
+
+      //Modify the relocated list
+      _testShmBody b; std::memset(&b, 0, sizeof(b)); b.id_ = n;
+      const _testShmBody* pb = lb->at(1);
+      flag = lb->erase(pb) && (NULL == lb->at(1)) && (false == lb->erase(pb)) &&
+          (NULL != lb->create(n, b)) && (n == lb->begin()->id_) &&
+          (NULL == lb->create(n, b)) && (false == lb->erase(&b)) &&
+          (static_cast<std::size_t>(n - (n+6)/7) == lb->size());
+      while(flag && lb->size() < _testShmList::getCapacity())
+      { flag = (NULL != lb->create(static_cast<int>(lb->size())+2*n, b)); }
+      flag = flag && (NULL == lb->create(-1, b)) && lb->clear() && lb->empty() &&
+          (lb->begin() == lb->end()) && (NULL != lb->create(5, b));
+      delete segb;
+      if(false == flag)
+      { throw(std::runtime_error("Could not modify a relocated shared list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Erased, created and filled a relocated list"; }
+
+      /** **********************
+       * Shared memory : The server builds a list, the client reads it
+       * *********************** */
+      //Create the segment before forking, so the client can't see a stale one
+      sutil::CSharedMemory<_testShmList, char, true> shm_server(8081,'x');
+      if(false == shm_server.shmCreate())
+      { throw(std::runtime_error("Server: Failed to create shared memory")); }
+      if(0 != reinterpret_cast<std::size_t>(shm_server.data_) % alignof(_testShmList))
+      { throw(std::runtime_error("Server: The shared list isn't aligned")); }
+      *shm_server.data_signal_ = '0';
+
+      std::cout<<std::flush;
+      pid_child = fork();
+
+      if(0 == pid_child)
+      {//Child process (client). Attaches the segment afresh (at another address).
+        sutil::CSharedMemory<_testShmList, char, true> shm_client(8081,'x');
+        flag = shm_client.shmRead();
+        while(flag && 'r' != *shm_client.data_signal_)
+        { usleep(1000); }
+
+        //Read the server's list in place, then change it
+        flag = flag && _testShmCheck(*shm_client.data_, n) &&
+            shm_client.data_->erase(2) && (NULL != shm_client.data_->create(2*n, false));
+        if(flag) { shm_client.data_->at(2*n)->id_ = 2*n; }
+        *shm_client.data_signal_ = flag ? 'p' : 'f';
+
+        while('b' != *shm_client.data_signal_)
+        { usleep(1000); }
+        shm_client.shmDetach();
+      }
+      else
+      {//Parent process (server)
+        flag = _testShmFill(*shm_server.data_, n);
+        if(false == flag)
+        { throw(std::runtime_error("Server: Failed to build the shared list")); }
+        *shm_server.data_signal_ = 'r';
+
+        int wait = 0;
+        while('p' != *shm_server.data_signal_ && 'f' != *shm_server.data_signal_ && wait < 10000)
+        { usleep(1000); ++wait; }
+        flag = ('p' == *shm_server.data_signal_) && (NULL == shm_server.data_->at(2)) &&
+            (2*n == shm_server.data_->at(2*n)->id_);
+        const _testShmBody* last = NULL;
+        _testShmList::iterator it,ite;
+        for(it = shm_server.data_->begin(), ite = shm_server.data_->end(); it!=ite; ++it)
+        { last = &(*it); }
+        flag = flag && (NULL != last) && (2*n == last->id_);
+
+        *shm_server.data_signal_ = 'b';
+        while(!shm_server.shmCheckDetach())
+        { usleep(1000); }
+
+        if(false == flag)
+        { throw(std::runtime_error("The client couldn't read or change the server's shared list")); }
+        else { std::cout<<"\nTest Result ("<<test_id++<<") Client read and changed a "<<n<<" element list in shared memory"; }
+
+        std::cout<<"\nTest #"<<arg_id<<" (Shared Memory Mapped List Test) Succeeded.";
+      }
+    }
+    catch(std::exception& ee)
+    {
+      std::cout<<"\nTest Error ("<<test_id++<<") "<<ee.what();
+      std::cout<<"\nTest #"<<arg_id<<" (Shared Memory Mapped List Test) Failed";
+    }
+
+    if(0 == pid_child)//The child process doesn't need to continue.
+    { exit(0);  }
+  }
+}
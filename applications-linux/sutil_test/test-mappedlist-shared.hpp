@@ -0,0 +1,23 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-shared.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef TEST_MAPPEDLIST_SHARED_HPP_
+#define TEST_MAPPEDLIST_SHARED_HPP_
+
+namespace sutil_test
+{
+  /** Tests the shared memory mapped list (relocation, and reading
+   * it from another process)
+   * @param arg_id : The id of the test */
+  void test_mappedlist_shared(const int arg_id);
+}
+#endif /* TEST_MAPPEDLIST_SHARED_HPP_ */
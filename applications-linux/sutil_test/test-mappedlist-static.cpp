@@ -0,0 +1,242 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/*
+ * test-mappedlist-static.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+#include "test-mappedlist-static.hpp"
+
+#include <sutil/CStaticMappedList.hpp>
+#include <sutil/CStaticMappedTree.hpp>
+#include <sutil/CStaticMappedMultiLevelList.hpp>
+#include <sutil/CMappedListIndexHash.hpp>
+#include <sutil/CMappedListStats.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace sutil_test
+{
+  /** A weak heap check : Reads the heap bytes in use (glibc's mallinfo2)
+   * before and after a block, and reports if the block left memory
+   * allocated. It doesn't count allocations, so one that is freed again
+   * before the check is missed. Without glibc 2.33 or later it can't
+   * read the heap, so available() is false and changed() never is. */
+  class _testHeapProbe
+  {
+  public:
+    _testHeapProbe() : start_(inUse()) {}
+    void reset() { start_ = inUse(); }
+    bool changed() const { return inUse() != start_; }
+
+    static bool available()
+    {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+      return true;
+#else
+      return false;
+#endif
+    }
+
+  private:
+    static std::size_t inUse()
+    {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+      struct mallinfo2 mi = mallinfo2();
+      return mi.uordblks + mi.hblkhd;
+#else
+      return 0;
+#endif
+    }
+    std::size_t start_;
+  };
+
+  /** Test Structure - Mapped tree Node (stored inside the tree, so it
+   * uses the default tree's node base) */
+  struct _testStaticNode : public sutil::CMappedTree<std::string,_testStaticNode>::SMTNodeBase
+  {
+  public:
+    int random_data_;
+  };
+
+  void test_mappedlist_static(const int arg_id)
+  {
+    bool flag = true;
+    unsigned int test_id=0;
+    try
+    {
+      /** **********************
+       * Static mapped list
+       * *********************** */
+      sutil::CStaticMappedList<int,double,16> sl;
+      _testHeapProbe heap;
+      if(false == _testHeapProbe::available())
+      { std::cout<<"\nTest Result ("<<test_id++<<") Can't read the heap (needs glibc 2.33). Skipping the heap checks."; }
+      double* p[16];
+      for(int i=0; i<16; ++i)
+      { p[i] = sl.create(i*3, static_cast<double>(i), false); flag = flag && (NULL != p[i]); }
+      flag = flag && sl.full() && (NULL == sl.create(100, 1.0)) && (NULL == sl.create(3, 1.0));
+      for(int i=0; i<16 && flag; ++i) { flag = (sl.at(i*3) == p[i]) && (*sl.at(static_cast<std::size_t>(i)) == i); }
+      double sum = 0.0;
+      sutil::CStaticMappedList<int,double,16>::iterator it, ite;
+      for(it = sl.begin(), ite = sl.end(); it!=ite; ++it) { sum += *it; }
+      flag = flag && (120.0 == sum);
+      if(false == flag || 16 != sl.size())
+      { throw(std::runtime_error("Static mapped list failed to create, find or iterate over elements")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped list created 16 elements and refused the 17th"; }
+
+      //Churn : Erase and recreate (the others' pointers stay valid)
+      for(int k=0; k<1000 && flag; ++k)
+      {
+        const int i = k%16;
+        flag = sl.erase(i*3) && (NULL == sl.at(i*3)) && (15 == sl.size());
+        p[i] = sl.create(i*3, static_cast<double>(i), false);
+        flag = flag && (NULL != p[i]) && (sl.at((i+1)%16*3) == p[(i+1)%16]);
+        flag = flag && sl.erase(p[i]);
+        p[i] = sl.create(i*3, static_cast<double>(i));
+        flag = flag && (NULL != p[i]) && (NULL != sl.at(static_cast<std::size_t>(15)));
+      }
+      if(false == flag)
+      { throw(std::runtime_error("Static mapped list failed to erase and recreate elements")); }
+      if(heap.changed())
+      { throw(std::runtime_error("Static mapped list held heap memory after 4000 creates/erases")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped list did 4000 creates/erases without holding heap memory"; }
+
+      sutil::CStaticMappedList<int,double,16> sl2(sl);
+      flag = (sl2 == sl) && (sl2.at(9) != sl.at(9)) && (*sl2.at(9) == 3.0);
+      sl.clear();
+      flag = flag && (0 == sl.size()) && (NULL == sl.at(9)) && (16 == sl2.size());
+      if(false == flag)
+      { throw(std::runtime_error("Static mapped list failed to copy or clear")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped list copied and cleared"; }
+
+      //With a hash index (for larger lists)
+      sutil::CStaticMappedList<std::string,int,64,
+        sutil::CMappedListIndexHash<std::string,int> > slh;
+      std::string keys[65];
+      for(int i=0; i<65; ++i) { keys[i] = "link_"; keys[i] += static_cast<char>('0'+i); }
+      heap.reset();
+      for(int i=0; i<64; ++i) { flag = flag && (NULL != slh.create(keys[i], i)); }
+      flag = flag && (NULL == slh.create(keys[64], 64)) && (*slh.at(keys[40]) == 40);
+      flag = flag && slh.erase(keys[3]) && (NULL != slh.create(keys[64], 64));
+      if(false == flag || heap.changed())
+      { throw(std::runtime_error("Static mapped list with a hash index failed or held heap memory")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped list works (without holding heap memory) with a hash index"; }
+
+      /** **********************
+       * Static mapped tree
+       * *********************** */
+      sutil::CStaticMappedTree<std::string,_testStaticNode,8> st;
+      _testStaticNode node;
+      node.name_ = "root"; node.parent_name_ = "ground";
+      st.create(node.name_,node,true);
+      node.name_ = "l1"; node.parent_name_ = "root";
+      st.create(node.name_,node,false);
+      node.name_ = "l2"; node.parent_name_ = "l1";
+      st.create(node.name_,node,false);
+      if(false == st.linkNodes() ||
+          st.at("l2")->parent_addr_ != st.at("l1") ||
+          st.at("l1")->parent_addr_ != st.getRootNode() || 8 != st.capacity())
+      { throw(std::runtime_error("Static mapped tree failed to link nodes")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped tree linked nodes"; }
+
+      heap.reset();
+      flag = true;
+      for(int k=0; k<100 && flag; ++k)
+      {
+        _testStaticNode* n = st.create("l3", false);
+        flag = (NULL != n) && (st.at("l3") == n) && st.erase(n) && (NULL == st.at("l3"));
+      }
+      if(false == flag || heap.changed())
+      { throw(std::runtime_error("Static mapped tree held heap memory (or failed) after linking")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped tree created and erased nodes without holding heap memory"; }
+
+      /** **********************
+       * Static mapped multi-level list
+       * *********************** */
+      sutil::CStaticMappedMultiLevelList<int,double,8,3> sml;
+      heap.reset();
+      std::size_t n0, n1, n2;
+      flag = (NULL != sml.create(1, 1.0, 1)) && (NULL != sml.create(2, 2.0, 0)) &&
+          (NULL != sml.create(3, 3.0, 1)) && (NULL != sml.create(4, 4.0, 2)) &&
+          (NULL == sml.create(5, 5.0, 3)) && (NULL == sml.create(1, 1.0, 0));
+      double* const* l0 = sml.getSinglePriorityLevel(0, n0);
+      double* const* l1 = sml.getSinglePriorityLevel(1, n1);
+      double* const* l2 = sml.getSinglePriorityLevel(2, n2);
+      flag = flag && (1 == n0) && (2 == n1) && (1 == n2) && (2.0 == *l0[0]) &&
+          (1.0 == *l1[0]) && (3.0 == *l1[1]) && (4.0 == *l2[0]) &&
+          (3 == sml.getNumPriorityLevels()) && (1 == sml.getPriorityLevel(3)) &&
+          (-1 == sml.getPriorityLevel(7));
+      flag = flag && sml.erase(4) && (2 == sml.getNumPriorityLevels()) &&
+          sml.erase(sml.at(1)) && (NULL == sml.at(1)) && (1 == sml.getPriorityLevel(3));
+      l1 = sml.getSinglePriorityLevel(1, n1);
+      flag = flag && (1 == n1) && (3.0 == *l1[0]) && (2 == sml.size());
+      if(false == flag || heap.changed())
+      { throw(std::runtime_error("Static mapped multi-level list failed or held heap memory")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped multi-level list kept its levels without holding heap memory"; }
+
+      //Batched erases (each shifts the levels once)
+      flag = (NULL != sml.create(5, 5.0, 2)) && (NULL != sml.create(6, 6.0, 0)) &&
+          (NULL != sml.create(7, 7.0, 1)) && (NULL != sml.create(8, 8.0, 2));
+      flag = flag && (2 == sml.erase_if([](const double& v){ return v >= 7.0; })) && (4 == sml.size());
+      l0 = sml.getSinglePriorityLevel(0, n0);
+      l2 = sml.getSinglePriorityLevel(2, n2);
+      flag = flag && (2 == n0) && (2.0 == *l0[0]) && (6.0 == *l0[1]) && (1 == n2) && (5.0 == *l2[0]) &&
+          (3 == sml.getNumPriorityLevels()) && (NULL == sml.at(7));
+      const int ekeys[3] = {5, 9, 2};
+      flag = flag && (2 == sml.erase(ekeys, ekeys+3)) && (2 == sml.getNumPriorityLevels());
+      l0 = sml.getSinglePriorityLevel(0, n0);
+      l1 = sml.getSinglePriorityLevel(1, n1);
+      flag = flag && (1 == n0) && (6.0 == *l0[0]) && (1 == n1) && (3.0 == *l1[0]) && (2 == sml.size()) &&
+          (0 == sml.erase_if([](const double& v){ return v < 0.0; }));
+      if(false == flag || heap.changed())
+      { throw(std::runtime_error("Static mapped multi-level list failed to batch erase, or held heap memory")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped multi-level list batch erased without holding heap memory"; }
+
+      //Batched erases on a few thousand elements walk the list once each
+      typedef sutil::CStaticMappedMultiLevelList<int,double,4096,4,
+          sutil::CMappedListIndexSmall<int,double,4096,sutil::CMappedListIndexNone<int,double> >,
+          sutil::CMappedListStatsCount> _testBigSml;
+      _testBigSml* smlbig = new _testBigSml();
+      flag = true;
+      for(int i=0; i<4096 && flag; ++i) { flag = (NULL != smlbig->create(i, static_cast<double>(i), static_cast<std::size_t>(i%4))); }
+      smlbig->getStats().reset();
+      flag = flag && (2048 == smlbig->erase_if([](const double& v){ return 1 == static_cast<int>(v)%2; }));
+      std::vector<int> bigkeys;
+      for(int i=0; i<4096; i+=4) { bigkeys.push_back(i); bigkeys.push_back(i); } //Repeated keys
+      flag = flag && (1024 == smlbig->erase(bigkeys.begin(), bigkeys.end())) && (1024 == smlbig->size());
+      std::size_t nbig = 0, nlvl;
+      for(std::size_t pri=0; flag && pri<4; ++pri)
+      {
+        double* const* lvl = smlbig->getSinglePriorityLevel(pri, nlvl);
+        for(std::size_t j=0; flag && j<nlvl; ++j)
+        { flag = (2 == static_cast<int>(*lvl[j])%4) && (lvl[j] == smlbig->at(static_cast<int>(*lvl[j]))); }
+        nbig += nlvl;
+      }
+      flag = flag && (1024 == nbig) && (smlbig->getStats().get().nodes_walked_ <= 2*4096);
+      delete smlbig;
+      if(false == flag)
+      { throw(std::runtime_error("Static mapped multi-level list batch erases failed or walked the list per element")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Static mapped multi-level list batch erased 3072 of 4096 elements in one walk each"; }
+
+      std::cout<<"\nTest #"<<arg_id<<" (Static Mapped List Test) Succeeded.";
+    }
+    catch(std::exception& ee)
+    {
+      std::cout<<"\nTest Error ("<<test_id++<<") "<<ee.what();
+      std::cout<<"\nTest #"<<arg_id<<" (Static Mapped List Test) Failed";
+    }
+  }
+}
@@ -15,7 +15,9 @@ See the Readme.txt file in the root folder for licensing information.
 
 #include <sutil/CMemCopier.hpp>
 #include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListFrozen.hpp>
 #include <sutil/CMappedMultiLevelList.hpp>
+#include <sutil/CMappedListStats.hpp>
 
 #include <iostream>
 #include <math.h>
@@ -23,9 +25,40 @@ See the Readme.txt file in the root folder for licensing information.
 #include <stdlib.h>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
+#include <utility>
+#include <iterator>
 
 namespace sutil_test
 {
+  /** Counts its copies and moves (to test in-place creation) */
+  struct _testCopyCounter
+  {
+    static int copies_, moves_;
+    std::vector<double> data_;
+    _testCopyCounter() {}
+    _testCopyCounter(const std::size_t arg_n, const double arg_val) : data_(arg_n,arg_val) {}
+    _testCopyCounter(const _testCopyCounter& arg_c) : data_(arg_c.data_) { copies_++; }
+    _testCopyCounter(_testCopyCounter&& arg_c) : data_(std::move(arg_c.data_)) { moves_++; }
+  };
+  int _testCopyCounter::copies_ = 0;
+  int _testCopyCounter::moves_ = 0;
+
+  /** Orders doubles from largest to smallest */
+  struct _testDescending
+  {
+    bool operator()(const double& arg_a, const double& arg_b) const
+    { return arg_a > arg_b; }
+  };
+
+  /** Builds a list and returns it by value (needs the move constructor) */
+  sutil::CMappedList<int,double> _testBuildList(const int arg_n)
+  {
+    sutil::CMappedList<int,double> ret;
+    for(int i=0; i<arg_n; ++i) { ret.create(i,static_cast<double>(i),false); }
+    return ret;
+  }
+
   /** Tests the mapped list utility
    * @param arg_id : The id of the test */
   void test_mappedlist(const int arg_id)
@@ -268,6 +301,54 @@ namespace sutil_test
 
       std::cout<<std::flush;//Time for the next round
 
+      //Test the position cache (positional queries are O(1) between changes)
+      flag = true;
+      for(unsigned int i=0; i<mappedlist.size() && flag; ++i)
+      {
+        t2 = mappedlist.at(i);
+        flag = (NULL != t2) && (static_cast<int>(i) == mappedlist.getIndexNumericAt(t2)) &&
+            (mappedlist.at(*mappedlist.getIndexAt(i)) == t2) &&
+            (static_cast<int>(i) == mappedlist.getIndexNumericAt(*mappedlist.getIndexAt(i)));
+      }
+      double not_in_list = 0.0;
+      if(false == flag || -1 != mappedlist.getIndexNumericAt(&not_in_list) ||
+          NULL != mappedlist.at(mappedlist.size()) || NULL != mappedlist.getIndexAt(mappedlist.size()))
+      { throw(std::runtime_error("Position cache returned inconsistent positions")); }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Position cache matches the list order"; }
+
+      //Erasing the front must shift every position by one
+      t3 = mappedlist.at(1);
+      t2 = mappedlist.at(mappedlist.size()-1);
+      flag = mappedlist.erase(mappedlist.at(0));
+      if(false == flag || mappedlist.at(0) != t3 || 0 != mappedlist.getIndexNumericAt(t3) ||
+          static_cast<int>(mappedlist.size()-1) != mappedlist.getIndexNumericAt(t2))
+      { throw(std::runtime_error("Position cache wasn't updated after an erase")); }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Position cache updated after an erase"; }
+
+      //Const queries read a stale cache's list without rebuilding the cache
+      const sutil::CMappedList<std::string,double>& mlconst = mappedlist;
+      t3 = mappedlist.at(1);
+      flag = mappedlist.erase(mappedlist.at(0));
+      const std::string* idlast = mlconst.getIndexAt(mlconst.size()-1);
+      flag = flag && (mlconst.at_const(0) == t3) && (0 == mlconst.getIndexNumericAt(t3)) &&
+          (static_cast<int>(mlconst.size()-1) == mlconst.getIndexNumericAt(t2)) &&
+          (NULL != idlast) && (mlconst.at_const(*idlast) == t2) && (NULL == mlconst.at_const(mlconst.size()));
+      mappedlist.cachePositions();
+      flag = flag && (mlconst.at_const(0) == t3) && (mlconst.getIndexAt(mlconst.size()-1) == idlast) &&
+          (static_cast<int>(mlconst.size()-1) == mlconst.getIndexNumericAt(t2));
+      if(false == flag)
+      { throw(std::runtime_error("Const positional queries were wrong with a stale (or rebuilt) cache")); }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Const positional queries walk a stale cache's list"; }
+
+      time1 = sutil::CSystemClock::getSysTime();
+      int pos_sum = 0;
+      for(long long i=0;i<10000;i++)
+      { pos_sum += mappedlist.getIndexNumericAt(t2); }
+      time2 = sutil::CSystemClock::getSysTime();
+      std::cout<<"\nTest Result ("<<test_id++<<") Mapped list Numeric Index of Last Element Stress : "<<mappedlist.size()
+          <<" entries ("<<pos_sum/10000<<") 10,000 times"
+          <<" in "<<time2-time1<<" seconds";
+
       /**  **********************
        * Test operators
        * *********************** */
@@ -651,6 +732,364 @@ namespace sutil_test
       if(3 != mls2.getIndexNumericAt(mls2.at("8"))) { throw(std::runtime_error("Numeric index failed at 3")); }
       std::cout<<"\nTest Result ("<<test_id++<<") Tested numeric index computing function";
 
+      /**  **********************
+       * Test in-place and move-aware creation
+       * *********************** */
+      sutil::CMappedList<std::string,_testCopyCounter> mlc;
+      _testCopyCounter::copies_ = 0; _testCopyCounter::moves_ = 0;
+      _testCopyCounter *c1 = mlc.emplace("c1", 100, 2.0);
+      _testCopyCounter *c2 = mlc.emplace_back(std::string("c2"), 10, 1.0);
+      _testCopyCounter *c3 = mlc.create("c3");
+      if(NULL == c1 || NULL == c2 || NULL == c3 || 100 != c1->data_.size() ||
+          2.0 != c1->data_[99] || 0 != c3->data_.size() || mlc.at(2) != c2 ||
+          0 != _testCopyCounter::copies_ || 0 != _testCopyCounter::moves_)
+      { throw(std::runtime_error("Emplace copied or moved the element")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Emplaced and created elements in place (no copies)"; }
+
+      if(NULL != mlc.emplace("c1", 5, 5.0) || 3 != mlc.size() || 100 != mlc.at("c1")->data_.size())
+      { throw(std::runtime_error("Emplace created a duplicate element")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Emplace rejected a duplicate element"; }
+
+      _testCopyCounter heavy(1000, 3.0);
+      _testCopyCounter *c4 = mlc.create(std::string("c4"), std::move(heavy), false);
+      _testCopyCounter *c5 = mlc.create("c5", _testCopyCounter(7, 7.0));
+      if(NULL == c4 || NULL == c5 || 1000 != c4->data_.size() || 0 != heavy.data_.size() ||
+          mlc.at(std::size_t(0)) != c5 || mlc.at(4) != c4 || 7 != c5->data_.size() ||
+          0 != _testCopyCounter::copies_ || 2 != _testCopyCounter::moves_)
+      { throw(std::runtime_error("Rvalue create copied the element")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Rvalue create moved the elements (no copies)"; }
+
+      _testCopyCounter light(2, 1.0);
+      if(NULL == mlc.create("c6", light) || 2 != light.data_.size() || 1 != _testCopyCounter::copies_)
+      { throw(std::runtime_error("Lvalue create didn't copy the element")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Lvalue create still copies the element"; }
+
+      /**  **********************
+       * Test O(1) move construction, move assignment and swap
+       * *********************** */
+      sutil::CMappedList<int,double> mlm(_testBuildList(1000));
+      double *m500 = mlm.at(500);
+      if(1000 != mlm.size() || NULL == m500 || 500.0 != *m500 ||
+          999.0 != *mlm.at(999) || mlm.getIndexNumericAt(m500) != 500)
+      { throw(std::runtime_error("Failed to move-construct a list returned by value")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Move-constructed a list returned by value"; }
+
+      sutil::CMappedList<int,double> mlm2(std::move(mlm));
+      if(0 != mlm.size() || NULL != mlm.at(500) || mlm.begin() != mlm.end() ||
+          1000 != mlm2.size() || mlm2.at(500) != m500)
+      { throw(std::runtime_error("Move construction moved or lost the elements")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Move construction kept element addresses"; }
+
+      //Walk back from end() to check that the sentinel was re-linked
+      sutil::CMappedList<int,double>::iterator itm = mlm2.end();
+      --itm;
+      if(999.0 != *itm) { throw(std::runtime_error("end() wasn't re-linked after a move")); }
+      flag = true; i = 0;
+      for(itm = mlm2.begin(); itm != mlm2.end(); ++itm, ++i)
+      { flag = flag && (*itm == static_cast<double>(i)); }
+      if(false == flag || 1000 != i)
+      { throw(std::runtime_error("Failed to iterate over a moved list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Iterated forward and back over a moved list"; }
+
+      mlm = _testBuildList(3);
+      mlm2 = std::move(mlm2); //Self move is a no-op
+      mlm.swap(mlm2);
+      if(1000 != mlm.size() || 3 != mlm2.size() || mlm.at(500) != m500 ||
+          2.0 != *mlm2.at(2) || NULL != mlm2.at(500) || 999.0 != *(--mlm.end()) ||
+          2.0 != *(--mlm2.end()))
+      { throw(std::runtime_error("Failed to move-assign and swap lists")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Move-assigned and swapped lists"; }
+
+      mlm2.create(-7,7.0,false);
+      mlm2 = std::move(mlm);
+      if(1000 != mlm2.size() || mlm2.at(500) != m500 || NULL != mlm2.at(-7) ||
+          0 != mlm.size() || NULL == mlm.create(1,1.0) || 1 != mlm.size())
+      { throw(std::runtime_error("Move assignment failed to release the old elements")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Move assignment released the old elements"; }
+
+      /**  **********************
+       * Test the frozen (contiguous) snapshot
+       * *********************** */
+      sutil::CMappedList<std::string,double> mlf;
+      std::stringstream ssf;
+      for(int j=0; j<10000; ++j)
+      { ssf.str(""); ssf<<"f"<<j; mlf.create(ssf.str(),static_cast<double>(j),false); }
+      sutil::CMappedListFrozen<std::string,double> frozen;
+      flag = frozen.compile(mlf);
+      if(false == flag || 10000 != frozen.size() || false == frozen.isValid(mlf) ||
+          frozen.begin()+10000 != frozen.end() || 42.0 != *frozen.at("f42") ||
+          NULL != frozen.at("g1") || 9999 != frozen.getIndexNumericAt("f9999") ||
+          "f17" != *frozen.getIndexAt(17) || 17.0 != frozen[17])
+      { throw(std::runtime_error("Failed to compile a frozen snapshot")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Compiled a frozen snapshot of 10000 elements"; }
+
+      flag = true; i = 0;
+      sutil::CMappedList<std::string,double>::iterator itf;
+      const double *itv = frozen.begin();
+      for(itf = mlf.begin(); itf != mlf.end(); ++itf, ++itv, ++i)
+      { flag = flag && (*itf == *itv) && (mlf.at(*frozen.getIndexAt(i)) == mlf.at(i)); }
+      if(false == flag || frozen.end() != itv)
+      { throw(std::runtime_error("Frozen snapshot order doesn't match the list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Frozen snapshot matches the list's order"; }
+
+      //Sum over the list and over the snapshot
+      double sum_list = 0.0, sum_frozen = 0.0;
+      for(itf = mlf.begin(); itf != mlf.end(); ++itf) { sum_list += *itf; }
+      for(const double *it = frozen.begin(), *ite = frozen.end(); it != ite; ++it) { sum_frozen += *it; }
+      if(sum_list != sum_frozen)
+      { throw(std::runtime_error("Frozen snapshot sum doesn't match the list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Summed 10000 elements over the list and the snapshot"; }
+
+      mlf.erase("f3");
+      sutil::CMappedList<std::string,double> mlf2;
+      if(frozen.isValid(mlf) || frozen.isValid(mlf2) || 3.0 != *frozen.at("f3"))
+      { throw(std::runtime_error("Frozen snapshot wasn't invalidated by an erase")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Frozen snapshot invalidated by an erase"; }
+
+      flag = frozen.compile(mlf);
+      std::vector<std::string> forder;
+      for(int j=9999; j>=0; --j)
+      { if(3 != j) { ssf.str(""); ssf<<"f"<<j; forder.push_back(ssf.str()); } }
+      bool flag2 = frozen.isValid(mlf) && NULL == frozen.at("f3") && 9999 == frozen.size();
+      flag = flag && flag2 && mlf.sort(forder);
+      if(false == flag || frozen.isValid(mlf))
+      { throw(std::runtime_error("Frozen snapshot wasn't invalidated by a sort")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Recompiled, then invalidated by a sort"; }
+
+      /**  **********************
+       * Test bulk loading
+       * *********************** */
+      std::vector<std::pair<std::string,double> > bulk;
+      for(int j=0; j<100000; ++j)
+      { ssf.str(""); ssf<<"b"<<(j*7919)%100000; bulk.push_back(std::make_pair(ssf.str(),static_cast<double>(j))); }
+
+      sutil::CMappedList<std::string,double> mlb, mlb2;
+      for(std::size_t j=0; j<bulk.size(); ++j) { mlb2.create(bulk[j].first,bulk[j].second,false); }
+      flag = mlb.createRange(bulk.begin(), bulk.end());
+      if(false == flag || 100000 != mlb.size() || mlb != mlb2 || 5.0 != *mlb.at(5) ||
+          bulk[77].first != *mlb.getIndexAt(77) || 77.0 != *mlb.at(bulk[77].first))
+      { throw(std::runtime_error("Failed to bulk load a mapped list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Loaded 100000 elements with createRange()"; }
+
+      bulk.resize(3); bulk[2].first = bulk[0].first;
+      flag = mlb2.clear() && (false == mlb2.createRange(bulk.begin(), bulk.end())) && (0 == mlb2.size());
+      bulk.resize(2);
+      flag = flag && mlb2.createRange(bulk.begin(), bulk.end()) && (2 == mlb2.size());
+      flag = flag && (false == mlb2.createRange(bulk.begin()+1, bulk.end())) && (2 == mlb2.size());
+      if(false == flag)
+      { throw(std::runtime_error("Bulk load didn't reject a repeated index")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Bulk load rejected repeated and existing indices"; }
+
+      //Clone the 100k list (copies the index instead of re-inserting keys)
+      sutil::CMappedList<std::string,double> mlb3(mlb);
+      if(mlb3 != mlb || 100000 != mlb3.getIndex().size() ||
+          77.0 != *mlb3.at(bulk[77].first) || mlb3.at(bulk[77].first) == mlb.at(bulk[77].first) ||
+          false == mlb3.erase(bulk[77].first) || NULL == mlb.at(bulk[77].first))
+      { throw(std::runtime_error("Failed to clone a 100000 element mapped list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Cloned 100000 elements"; }
+
+      std::vector<std::pair<std::string,_testCopyCounter> > bulkc(3);
+      bulkc[0].first = "m0"; bulkc[1].first = "m1"; bulkc[2].first = "m2";
+      bulkc[1].second.data_.resize(50, 1.0);
+      _testCopyCounter::copies_ = 0; _testCopyCounter::moves_ = 0;
+      flag = mlc.assign(std::make_move_iterator(bulkc.begin()), std::make_move_iterator(bulkc.end()));
+      if(false == flag || 3 != mlc.size() || 50 != mlc.at("m1")->data_.size() ||
+          0 != bulkc[1].second.data_.size() || "" != bulkc[2].first || NULL != mlc.at("c1") ||
+          0 != _testCopyCounter::copies_ || 3 != _testCopyCounter::moves_)
+      { throw(std::runtime_error("Bulk assign didn't move the elements")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Bulk assign moved the elements (no copies)"; }
+
+      /**  **********************
+       * Test comparator and permutation sorts
+       * *********************** */
+      //mlb has 100000 elements with values in a scrambled order.
+      double *b5 = mlb.at("b5");
+      flag = mlb.sort(_testDescending());
+      std::vector<std::string> border;
+      flag = flag && mlb.isSorted() && mlb.sort_get_order(border) && (100000 == border.size());
+      i = 0;
+      double prev = 1e10;
+      for(itf = mlb.begin(); itf != mlb.end() && flag; ++itf, ++i)
+      {
+        flag = (*itf <= prev) && (mlb.at(border[i]) == &(*itf));
+        prev = *itf;
+      }
+      if(false == flag || 100000 != i || mlb.at("b5") != b5 || 99999.0 != *mlb.at(std::size_t(0)) ||
+          0.0 != *(--mlb.end()) || *mlb.getIndexAt(1) != border[1])
+      { throw(std::runtime_error("Failed to sort a mapped list with a comparator")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Merge sorted 100000 elements with a comparator"; }
+
+      //Ties keep their order (stable)
+      sutil::CMappedList<int,double> mlsrt;
+      for(int j=0; j<100; ++j) { mlsrt.create(j,static_cast<double>(j%3),false); }
+      flag = mlsrt.sort(_testDescending());
+      for(int j=0; j<100 && flag; ++j)
+      {
+        const int *id = mlsrt.getIndexAt(j), *idn = mlsrt.getIndexAt(j+1);
+        if(NULL != idn && *mlsrt.at(*id) == *mlsrt.at(*idn)) { flag = (*id < *idn); }
+      }
+      if(false == flag || 2.0 != *mlsrt.at(std::size_t(0)) || 0.0 != *mlsrt.at(std::size_t(99)))
+      { throw(std::runtime_error("Comparator sort isn't stable")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Comparator sort is stable"; }
+
+      //Reverse with a permutation
+      std::vector<std::size_t> perm(100);
+      for(std::size_t j=0; j<100; ++j) { perm[j] = 99-j; }
+      const int first_id = *mlsrt.getIndexAt(0);
+      double *first_val = mlsrt.at(std::size_t(0));
+      flag = mlsrt.applyPermutation(perm);
+      if(false == flag || first_id != *mlsrt.getIndexAt(99) || first_val != mlsrt.at(std::size_t(99)) ||
+          mlsrt.at(first_id) != first_val || false == mlsrt.isSorted() || 100 != mlsrt.size() ||
+          first_val != &(*(--mlsrt.end())))
+      { throw(std::runtime_error("Failed to apply a permutation")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Applied a permutation"; }
+
+      perm[3] = perm[4];
+      flag = (false == mlsrt.applyPermutation(perm));
+      perm.resize(99);
+      flag = flag && (false == mlsrt.applyPermutation(perm));
+      perm.push_back(100);
+      flag = flag && (false == mlsrt.applyPermutation(perm)) && (first_id == *mlsrt.getIndexAt(99));
+      if(false == flag)
+      { throw(std::runtime_error("Applied an invalid permutation")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Rejected invalid permutations"; }
+
+      /**  **********************
+       * Test erasing by pointer (the default list walks to the node)
+       * *********************** */
+      double *adopted = new double(-5.0), stray_val = 0.0;
+      flag = (NULL != mlb.insert("adopted", adopted, false));
+      flag = flag && (false == mlb.erase(&stray_val)) && (false == mlb.erase(mlsrt.at(3)));
+      flag = flag && mlb.erase(adopted) && (NULL == mlb.at("adopted")) && (false == mlb.erase(adopted));
+      flag = flag && mlb.erase(b5) && (NULL == mlb.at("b5")) && (99999 == mlb.size());
+      if(false == flag)
+      { throw(std::runtime_error("Failed to erase elements by pointer without a node table")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Erased elements by pointer without a node table"; }
+
+      /**  **********************
+       * Test erasing by pointer (O(1) with a node table)
+       * *********************** */
+      sutil::CMappedList<std::string, double, sutil::CMappedListAllocNew<std::string,double>,
+        sutil::CMappedListIndexMap<std::string,double>, sutil::CMappedListStatsCount,
+        sutil::CMappedListRankNone<std::string,double>,
+        sutil::CMappedListNodeTableHash<std::string,double> > mlt;
+      std::vector<double*> eptrs;
+      flag = true;
+      for(itf = mlb.begin(); itf != mlb.end() && flag; ++itf)
+      {
+        eptrs.push_back(mlt.create(!itf, *itf, false));
+        flag = (NULL != eptrs.back());
+      }
+      flag = flag && (99999 == mlt.size());
+      eptrs.push_back(mlt.create("b5", 5.0, false));
+      adopted = new double(-5.0);
+      flag = flag && (NULL != mlt.insert("adopted", adopted, false));
+      flag = flag && (false == mlt.erase(&stray_val)) && (false == mlt.erase(mlb.at(3)));
+      flag = flag && mlt.erase(adopted) && (NULL == mlt.at("adopted")) && (false == mlt.erase(adopted));
+      mlt.getStats().reset();
+      for(std::size_t j=0, k=0; j<eptrs.size() && flag; ++j)
+      {
+        k = (k + 7919) % eptrs.size();
+        flag = mlt.erase(eptrs[k]);
+      }
+      if(false == flag || 0 != mlt.size() || NULL != mlt.at("b5") || mlt.begin() != mlt.end() ||
+          0 != mlt.getStats().get().nodes_walked_)
+      { throw(std::runtime_error("Failed to erase elements by pointer with a node table")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Erased 100000 elements by pointer (random order) without a walk"; }
+
+      /**  **********************
+       * Test a final (non-virtual) mapped list
+       * *********************** */
+      sutil::CMappedListFinal<int,double> mlfin;
+      for(int j=0; j<100; ++j) { flag = flag && (NULL != mlfin.create(j, static_cast<double>(j), false)); }
+      double fsum = 0.0;
+      for(std::size_t j=0; j<mlfin.size(); ++j) { *mlfin[j] += 1.0; fsum += *mlfin.at(j); }
+      sutil::CMappedListFinal<int,double> mlfin2(mlfin);
+      sutil::CMappedList<int,double>& mlfin_ref = mlfin2; //Virtual calls
+      flag = flag && (5050.0 == fsum) && (mlfin2 == mlfin) && (mlfin2.at(7) != mlfin.at(7)) &&
+          (8.0 == *mlfin_ref.at(7)) && mlfin_ref.erase(7) && (99 == mlfin2.size()) && (false == mlfin.empty());
+      mlfin2 = std::move(mlfin);
+      flag = flag && (0 == mlfin.size()) && (100 == mlfin2.size()) && (8.0 == *mlfin2.at(7));
+      if(false == flag)
+      { throw(std::runtime_error("A final mapped list didn't behave like a mapped list")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Created, accessed, copied and moved a final (non-virtual) mapped list"; }
+
+      /**  **********************
+       * Test key ordered range queries
+       * *********************** */
+      typedef sutil::CMappedList<std::string,int> rangelist;
+      rangelist mlk;
+      const char* kn[8] = {"leg_r", "arm_r", "arm", "torso", "arm_l", "arma", "arm_\xff", "head"};
+      for(int j=0; j<8; ++j) { mlk.create(kn[j], j); }
+      //Key order
+      rangelist::key_iterator<> kit, kite;
+      std::string kprev; int kn_seen = 0;
+      for(kit = mlk.key_begin(), kite = mlk.key_end(); kit!=kite; ++kit, ++kn_seen)
+      { flag = flag && (kprev < !kit) && (*kit == *mlk.at(!kit)); kprev = !kit; }
+      flag = flag && (8 == kn_seen);
+      //Bounds
+      flag = flag && ("arm" == !mlk.lower_bound("arm")) && ("arm_\xff" == !mlk.upper_bound("arm_r")) &&
+          ("arm_l" == !mlk.lower_bound("arm_")) && (mlk.key_end() == mlk.lower_bound("z")) &&
+          (mlk.key_begin() == mlk.upper_bound("a"));
+      std::pair<rangelist::key_iterator<>, rangelist::key_iterator<> > kr = mlk.equal_range("torso");
+      flag = flag && (3 == *kr.first) && (++kr.first == kr.second);
+      kr = mlk.equal_range("neck");
+      flag = flag && (kr.first == kr.second);
+      //Prefixes : "arm_*" is arm_l, arm_r and arm_\xff (but not arm or arma)
+      kr = mlk.prefix_range("arm_");
+      int kmask = 0;
+      for(; kr.first != kr.second; ++kr.first) { kmask |= 1<<(*kr.first); *kr.first += 100; }
+      flag = flag && (((1<<1)|(1<<4)|(1<<6)) == kmask) && (101 == *mlk.at("arm_r"));
+      const rangelist& mlkc = mlk;
+      std::pair<rangelist::key_const_iterator<>, rangelist::key_const_iterator<> > krc =
+          mlkc.prefix_range("arm_\xff");
+      flag = flag && ("arm_\xff" == !krc.first) && (106 == *krc.first) && (++krc.first == krc.second);
+      krc = mlkc.prefix_range("");
+      flag = flag && (krc.first == mlkc.key_begin()) && (krc.second == mlkc.key_end()) &&
+          (mlkc.prefix_range("b").first == mlkc.prefix_range("b").second);
+      //Backwards (a key_iterator converts to a key_const_iterator)
+      rangelist::key_const_iterator<> kcit = mlk.key_end();
+      --kcit;
+      flag = flag && ("torso" == !kcit) && (3 == *kcit);
+      if(false == flag)
+      { throw(std::runtime_error("Failed to run key ordered range queries")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Ran key ordered range and prefix queries"; }
+
+      /**  **********************
+       * Test batched erases
+       * *********************** */
+      sutil::CMappedList<int,int> mle;
+      for(int j=0; j<100000; ++j) { mle.create(j, j, false); }
+      std::vector<int> eorder(100000);
+      for(int j=0; j<100000; ++j) { eorder[j] = j; }
+      flag = mle.sort(eorder);
+      sutil::CMappedList<int,int> mle2(mle);
+      std::size_t nerased = mle.erase_if([](const int& v){ return 0 != v%4; });
+      for(int j=0; j<100000; ++j) { if(0 != j%4) { mle2.erase(j); } }
+      //The survivors keep their order (and the list stays sorted)
+      int eprev = -4;
+      sutil::CMappedList<int,int>::iterator eit, eite;
+      for(eit = mle.begin(), eite = mle.end(); eit!=eite; ++eit)
+      { flag = flag && (eprev + 4 == *eit) && (*eit == !eit); eprev = *eit; }
+      flag = flag && (75000 == nerased) && (25000 == mle.size()) && mle.isSorted() &&
+          (mle == mle2) && (NULL == mle.at(5)) && (99996 == eprev);
+      //The sort order drops the erased Idx
+      std::vector<int> esorted;
+      flag = flag && mle.sort_get_order(esorted) && (25000 == esorted.size()) &&
+          (0 == esorted[0]) && (4 == esorted[1]) && (99996 == esorted.back());
+      //Keys that are absent or repeated are skipped
+      const int ekeys[6] = {0, 4, 4, 5, 100000, 99996};
+      flag = flag && (3 == mle.erase(ekeys, ekeys+6)) && (24997 == mle.size()) &&
+          (8 == *mle.at(static_cast<std::size_t>(0))) && (99992 == *mle.at(static_cast<std::size_t>(24996))) &&
+          (NULL == mle.at(4)) && mle.isSorted() && (0 == mle.erase(ekeys, ekeys+6));
+      flag = flag && mle.sort_get_order(esorted) && (24997 == esorted.size()) &&
+          (8 == esorted[0]) && (99992 == esorted.back()) && (false == mle2.sort_get_order(esorted));
+      flag = flag && (24997 == mle.erase_if([](const int&){ return true; })) && mle.empty() &&
+          (mle.begin() == mle.end()) && (0 == mle.erase_if([](const int&){ return true; }));
+      if(false == flag)
+      { throw(std::runtime_error("Failed to batch erase elements")); }
+      else { std::cout<<"\nTest Result ("<<test_id++<<") Batch erased 75000 of 100000 elements"; }
+
       std::cout<<"\nTest #"<<arg_id<<" (Mapped list Test) Succeeded.";
     }
     catch(std::exception& ee)
@@ -789,13 +1228,143 @@ namespace sutil_test
       { throw(std::runtime_error("Failed to access single priority level in deep-copied object"));  }
       else  { std::cout<<"\nTest Result ("<<test_id++<<") Correctly accessed single priority level in deep-copied object"; }
 
-      //Test 7 : Test clear
+      //Test 7 : Move a node in at a priority level
+      tmp_var.val = 11.5; tmp_var.pri = 1;
+      t2 = mapmllist.create(std::string("t_moved"), std::move(tmp_var), 1);
+      if( (NULL==t2) || (11.5!=t2->val) || (t2!=mapmllist.at("t_moved")) ||
+          (t2!=mapmllist.getSinglePriorityLevel(1)->back()) || (1!=mapmllist.getPriorityLevel(t2)))
+      { throw(std::runtime_error("Failed to move a node into the mlpmap"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Moved a node into the mlpmap"; }
+
+      //Test 8 : Move the list
+      std::size_t mlsz = mapmllist.size();
+      sutil::CMappedMultiLevelList<std::string,SMapTester> mapmllist3(std::move(mapmllist));
+      if( (mlsz!=mapmllist3.size()) || (0!=mapmllist.size()) || (0!=mapmllist.getNumPriorityLevels()) ||
+          (t2!=mapmllist3.at("t_moved")) || (t2!=mapmllist3.getSinglePriorityLevel(1)->back()) ||
+          (1!=mapmllist3.getPriorityLevel(t2)) )
+      { throw(std::runtime_error("Failed to move the mlpmap"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Moved the mlpmap"; }
+      mapmllist.swap(mapmllist3);
+
+      //Test 9 : Bulk load with a priority per entry
+      std::vector<std::pair<std::string,SMapTester> > mlbulk(4);
+      std::vector<int> mlpri(4);
+      for(int j=0; j<4; ++j)
+      {
+        std::stringstream ssb; ssb<<"bulk"<<j;
+        mlbulk[j].first = ssb.str(); mlbulk[j].second.val = j; mlbulk[j].second.pri = 2*j;
+        mlpri[j] = 2*j;
+      }
+      sutil::CMappedMultiLevelList<std::string,SMapTester> mapmllist4;
+      flag = mapmllist4.createRange(mlbulk.begin(), mlbulk.end(), mlpri.begin());
+      if( (!flag) || (4!=mapmllist4.size()) || (7!=mapmllist4.getNumPriorityLevels()) ||
+          (mapmllist4.at("bulk3")!=mapmllist4.getSinglePriorityLevel(6)->at(0)) ||
+          (4!=mapmllist4.getPriorityLevel("bulk2")) || (0!=mapmllist4.getSinglePriorityLevel(1)->size()) )
+      { throw(std::runtime_error("Failed to bulk load the mlpmap"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Bulk loaded the mlpmap"; }
+
+      //Copy it (the list and each level keep their order)
+      sutil::CMappedMultiLevelList<std::string,SMapTester> mapmllist5(mapmllist4);
+      if( (4!=mapmllist5.size()) || (7!=mapmllist5.getNumPriorityLevels()) ||
+          (mapmllist5.at("bulk3")!=mapmllist5.getSinglePriorityLevel(6)->at(0)) ||
+          (mapmllist5.at("bulk3")==mapmllist4.at("bulk3")) ||
+          (4!=mapmllist5.getPriorityLevel("bulk2")) || (*mapmllist5.getIndexAt(0)!=*mapmllist4.getIndexAt(0)) ||
+          (false == mapmllist5.erase("bulk1")) || (0!=mapmllist5.getSinglePriorityLevel(2)->size()) )
+      { throw(std::runtime_error("Failed to copy the mlpmap"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Copied the mlpmap"; }
+
+      //Batched erases (each level is compacted once, the sort order drops the erased Idx)
+      std::vector<std::string> mlsorted;
+      mlsorted.push_back("bulk3"); mlsorted.push_back("bulk2"); mlsorted.push_back("bulk1"); mlsorted.push_back("bulk0");
+      flag = mapmllist4.sort(mlsorted);
+      mlsorted.erase(mlsorted.begin()+2);
+      flag = flag && mapmllist5.sort(mlsorted);
+      flag = flag && (3 == mapmllist4.erase_if([](const SMapTester& t){ return 0 != t.val; })) &&
+          (1 == mapmllist4.size()) && (1 == mapmllist4.getNumPriorityLevels()) &&
+          (mapmllist4.at("bulk0") == mapmllist4.getSinglePriorityLevel(0)->at(0));
+      const std::string mlkeys[4] = {"bulk0", "bulk3", "nope", "bulk0"};
+      flag = flag && (2 == mapmllist5.erase(mlkeys, mlkeys+4)) && (1 == mapmllist5.size()) &&
+          (5 == mapmllist5.getNumPriorityLevels()) && (NULL == mapmllist5.at("bulk3")) &&
+          (0 == mapmllist5.getSinglePriorityLevel(0)->size()) &&
+          (mapmllist5.at("bulk2") == mapmllist5.getSinglePriorityLevel(4)->at(0));
+      flag = flag && mapmllist4.sort_get_order(mlsorted) && (1 == mlsorted.size()) && ("bulk0" == mlsorted[0]) &&
+          mapmllist5.sort_get_order(mlsorted) && (1 == mlsorted.size()) && ("bulk2" == mlsorted[0]);
+      if(false == flag)
+      { throw(std::runtime_error("Failed to batch erase from the mlpmap"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Batch erased from the mlpmap"; }
+
+      //Batched erases on a few thousand elements walk the list once each
+      sutil::CMappedMultiLevelList<int, int, sutil::CMappedListAllocNew<int,int>,
+        sutil::CMappedListIndexMap<int,int>, sutil::CMappedListStatsCount> mlbig;
+      flag = true;
+      for(int i=0; i<4000 && flag; ++i) { flag = (NULL != mlbig.create(i, i, static_cast<std::size_t>(i%5))); }
+      mlbig.getStats().reset();
+      flag = flag && (2000 == mlbig.erase_if([](const int& v){ return 1 == v%2; })) && (2000 == mlbig.size());
+      std::vector<int> mlbigkeys;
+      for(int i=0; i<4000; i+=4) { mlbigkeys.push_back(i); } //Half are even (present)
+      flag = flag && (1000 == mlbig.erase(mlbigkeys.begin(), mlbigkeys.end())) && (1000 == mlbig.size());
+      std::size_t nlvl = 0;
+      for(std::size_t pri=0; flag && pri<mlbig.getNumPriorityLevels(); ++pri)
+      {
+        const std::vector<int*>& lvl = *mlbig.getSinglePriorityLevel(pri);
+        for(std::size_t j=0; flag && j<lvl.size(); ++j)
+        { flag = (2 == *lvl[j]%4) && (pri == static_cast<std::size_t>(*lvl[j]%5)) && (lvl[j] == mlbig.at(*lvl[j])); }
+        nlvl += lvl.size();
+      }
+      flag = flag && (1000 == nlvl) && (mlbig.getStats().get().nodes_walked_ <= 2*4000);
+      if(false == flag)
+      { throw(std::runtime_error("Batch erases on a large mlpmap failed or walked the list per element"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Batch erased 3000 of 4000 mlpmap elements, walking "
+          <<mlbig.getStats().get().nodes_walked_<<" nodes"; }
+
+      //With a node table, erasing by pointer doesn't walk the list at all
+      sutil::CMappedMultiLevelList<int, int, sutil::CMappedListAllocNew<int,int>,
+        sutil::CMappedListIndexMap<int,int>, sutil::CMappedListStatsCount,
+        sutil::CMappedListRankNone<int,int>, sutil::CMappedListNodeTableHash<int,int> > mlnt;
+      std::vector<int*> mlntptrs;
+      for(int i=0; i<4000; ++i) { mlntptrs.push_back(mlnt.create(i, i, static_cast<std::size_t>(i%5))); }
+      mlnt.getStats().reset();
+      flag = true;
+      for(std::size_t i=0; i<mlntptrs.size() && flag; i+=2) { flag = mlnt.erase(mlntptrs[i]); }
+      flag = flag && (2000 == mlnt.size()) && (0 == mlnt.getStats().get().nodes_walked_) &&
+          (NULL == mlnt.at(0)) && (mlntptrs[1] == mlnt.at(1));
+      if(false == flag)
+      { throw(std::runtime_error("Erasing by pointer walked an mlpmap with a node table")); }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Erased 2000 mlpmap elements by pointer without a walk"; }
+
+      //Test 10 : Test clear
       flag = mapmllist.clear();
 
       if( (!flag) || ( NULL != mapmllist.at(0)))
       { throw(std::runtime_error("Failed to clear mlpmap"));  }
       else  { std::cout<<"\nTest Result ("<<test_id++<<") Cleared mlpmap"; }
 
+      //A final (non-virtual) multi level list
+      sutil::CMappedMultiLevelListFinal<std::string,SMapTester> mapmllistf;
+      flag = (NULL != mapmllistf.create("f0", tmp_var, 2)) && (NULL != mapmllistf.create("f1", tmp_var, 0));
+      sutil::CMappedMultiLevelListFinal<std::string,SMapTester> mapmllistf2(mapmllistf);
+      flag = flag && (3 == mapmllistf2.getNumPriorityLevels()) && (2 == mapmllistf2.getPriorityLevel("f0")) &&
+          (mapmllistf2.at("f1") == mapmllistf2.getSinglePriorityLevel(0)->at(0)) &&
+          mapmllistf2.erase("f0") && (1 == mapmllistf2.getNumPriorityLevels()) && (2 == mapmllistf.size());
+      if(false == flag)
+      { throw(std::runtime_error("A final mlpmap didn't behave like a mlpmap"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Created, copied and erased in a final (non-virtual) mlpmap"; }
+
+      //Assigning through a CMappedList& copies the levels (or uses level 0)
+      sutil::CMappedList<std::string,SMapTester> mlplain;
+      mlplain.create("p0", tmp_var); mlplain.create("p1", tmp_var);
+      sutil::CMappedList<std::string,SMapTester>& mlref = mapmllistf2;
+      mlref = mapmllistf;
+      flag = (2 == mapmllistf2.size()) && (3 == mapmllistf2.getNumPriorityLevels()) &&
+          (2 == mapmllistf2.getPriorityLevel("f0")) && (mapmllistf2.at("f0") != mapmllistf.at("f0"));
+      mlref = mlplain;
+      flag = flag && (2 == mapmllistf2.size()) && (1 == mapmllistf2.getNumPriorityLevels()) &&
+          (2 == mapmllistf2.getSinglePriorityLevel(0)->size()) && (0 == mapmllistf2.getPriorityLevel("p1")) &&
+          (NULL == mapmllistf2.at("f0"));
+      if(false == flag)
+      { throw(std::runtime_error("Assigning to a mlpmap through a CMappedList& lost its levels"));  }
+      else  { std::cout<<"\nTest Result ("<<test_id++<<") Assigned a mlpmap and a plain list through a CMappedList&"; }
+
       std::cout<<"\nTest #"<<arg_id<<" (MappedMultiLevelList Test) Succeeded.";
     }
     catch(std::exception &e)
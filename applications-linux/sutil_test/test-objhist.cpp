@@ -20,6 +20,7 @@ See the Readme.txt file in the root folder for licensing information.
 #include <sstream>
 #include <vector>
 #include <stdexcept>
+#include <utility>
 
 namespace sutil_test
 {
@@ -156,6 +157,47 @@ namespace sutil_test
         throw(std::runtime_error( "Delete unsuccessful" ));
       }
 
+      //Move an object into the history (its memory shouldn't be copied)
+      SObjectToStore o2;
+      o2.x_ = 1; o2.y_ = 2; o2.z_ = 3;
+      o2.vec_.resize(1000, 4.0);
+      const double *o2vec = o2.vec_.data();
+      flag = oh.saveObject("o2",std::move(o2));
+      tobj = oh.getObject("o2");
+      if(false == flag || NULL == tobj || 1000 != tobj->vec_.size() ||
+          o2vec != tobj->vec_.data() || 3 != tobj->z_)
+      { throw(std::runtime_error( "Failed to move an object into the history" ));  }
+      else
+      { std::cout<<"\nTest Result ("<<test_id++<<") Moved an object into the history"; }
+
+      //Time range queries (in key order, without walking the history)
+      SObjectToStore o3;
+      for(int i=0; i<4 && flag; ++i)
+      {
+        //Wait for the clock to tick (so each save gets its own time stamp)
+        const double tsave = sutil::CSystemClock::getSysTime();
+        while(tsave == sutil::CSystemClock::getSysTime()) {}
+        o3.x_ = i; flag = oh.saveObject("o3",o3);
+      }
+      sutil::CObjectHistory<std::string,SObjectToStore>::time_iterator it3, it3e;
+      double t3[4]; j = 0;
+      flag = flag && oh.getObjectsBetween("o3", -1.0, 1e300, it3, it3e);
+      for(; flag && it3!=it3e; ++it3, ++j)
+      { flag = (j < 4) && (j == it3->x_); if(flag) { t3[j] = !it3; } }
+      flag = flag && (4 == j) && oh.getObjectsBetween("o3", t3[1], t3[2], it3, it3e) &&
+          (1 == it3->x_) && (2 == (++it3)->x_) && (++it3 == it3e) &&
+          oh.getObjectsBetween("o3", t3[2], t3[1], it3, it3e) && (it3 == it3e) &&
+          (false == oh.getObjectsBetween("o4", t3[0], t3[3], it3, it3e));
+      flag = flag && (2 == oh.getObjectAtOrBefore("o3", t3[2])->x_) &&
+          (2 == oh.getObjectAtOrBefore("o3", (t3[2]+t3[3])/2)->x_) &&
+          (3 == oh.getObjectAtOrBefore("o3", 1e300)->x_) &&
+          (NULL == oh.getObjectAtOrBefore("o3", t3[0]-1.0)) &&
+          (NULL == oh.getObjectAtOrBefore("o4", t3[0]));
+      if(false == flag)
+      { throw(std::runtime_error( "Failed to retrieve an object's states by time range" ));  }
+      else
+      { std::cout<<"\nTest Result ("<<test_id++<<") Retrieved an object's states by time range"; }
+
       std::cout<<"\nTest #"<<arg_id<<" (Object History Test) Succeeded.";
     }
     catch(std::exception& ee)
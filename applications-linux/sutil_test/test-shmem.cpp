@@ -89,6 +89,8 @@ namespace sutil_test
 
         //1. Create the shared memory
         flag = shmem.shmCreate();
+        //The default layout is the original one : The data follows the (char) signal
+        flag = flag && (reinterpret_cast<char*>(shmem.data_) == reinterpret_cast<char*>(shmem.data_signal_) + 1);
         if(false == flag)
         { throw(std::runtime_error("Server: Failed to create shared memory"));  }
         else
@@ -19,6 +19,12 @@ See the Readme.txt file in the root folder for licensing information.
 #include "test-shmem.hpp"
 #include "test-printables.hpp"
 #include "test-objhist.hpp"
+#include "test-mappedlist-alloc.hpp"
+#include "test-mappedlist-index.hpp"
+#include "test-mappedlist-concurrent.hpp"
+#include "test-mappedlist-image.hpp"
+#include "test-mappedlist-shared.hpp"
+#include "test-mappedlist-static.hpp"
 
 #include <sutil/CSingleton.hpp>
 #include <sutil/CSystemClock.hpp>
@@ -51,6 +57,13 @@ int main(int argc, char** argv)
     cout<<"\n"<<tid++<<" : Run callback registry tests";
     cout<<"\n"<<tid++<<" : Run shared memory tests";
     cout<<"\n"<<tid++<<" : Run printable tests";
+    cout<<"\n"<<tid++<<" : Run object history tests";
+    cout<<"\n"<<tid++<<" : Run mapped list allocator tests";
+    cout<<"\n"<<tid++<<" : Run mapped list index tests";
+    cout<<"\n"<<tid++<<" : Run concurrent mapped list tests";
+    cout<<"\n"<<tid++<<" : Run mapped list image tests";
+    cout<<"\n"<<tid++<<" : Run shared memory mapped list tests";
+    cout<<"\n"<<tid++<<" : Run static mapped list tests";
     cout<<"\n";
   }
   else
@@ -186,6 +199,72 @@ int main(int argc, char** argv)
     }
     ++id;
 
+    if((tid==0)||(tid==id))
+    {//Test mapped list allocators
+      std::cout<<"\n\nTest #"<<id<<". System Clock [Sys time, Sim time :"
+          <<sutil::CSystemClock::getSysTime()
+      <<" "
+      <<sutil::CSystemClock::getSimTime()
+      <<"]";
+      sutil_test::test_mappedlist_alloc(id);
+    }
+    ++id;
+
+    if((tid==0)||(tid==id))
+    {//Test mapped list indices
+      std::cout<<"\n\nTest #"<<id<<". System Clock [Sys time, Sim time :"
+          <<sutil::CSystemClock::getSysTime()
+      <<" "
+      <<sutil::CSystemClock::getSimTime()
+      <<"]";
+      sutil_test::test_mappedlist_index(id);
+    }
+    ++id;
+
+    if((tid==0)||(tid==id))
+    {//Test the concurrent mapped list
+      std::cout<<"\n\nTest #"<<id<<". System Clock [Sys time, Sim time :"
+          <<sutil::CSystemClock::getSysTime()
+      <<" "
+      <<sutil::CSystemClock::getSimTime()
+      <<"]";
+      sutil_test::test_mappedlist_concurrent(id);
+    }
+    ++id;
+
+    if((tid==0)||(tid==id))
+    {//Test the mapped list images
+      std::cout<<"\n\nTest #"<<id<<". System Clock [Sys time, Sim time :"
+          <<sutil::CSystemClock::getSysTime()
+      <<" "
+      <<sutil::CSystemClock::getSimTime()
+      <<"]";
+      sutil_test::test_mappedlist_image(id);
+    }
+    ++id;
+
+    if((tid==0)||(tid==id))
+    {//Test the shared memory mapped lists
+      std::cout<<"\n\nTest #"<<id<<". System Clock [Sys time, Sim time :"
+          <<sutil::CSystemClock::getSysTime()
+      <<" "
+      <<sutil::CSystemClock::getSimTime()
+      <<"]";
+      sutil_test::test_mappedlist_shared(id);
+    }
+    ++id;
+
+    if((tid==0)||(tid==id))
+    {//Test the fixed-capacity mapped lists
+      std::cout<<"\n\nTest #"<<id<<". System Clock [Sys time, Sim time :"
+          <<sutil::CSystemClock::getSysTime()
+      <<" "
+      <<sutil::CSystemClock::getSimTime()
+      <<"]";
+      sutil_test::test_mappedlist_static(id);
+    }
+    ++id;
+
     cout<<"\n\nEnding tests. Time:"<<sutil::CSystemClock::getSysTime()<<"\n";
   }
   return 0;
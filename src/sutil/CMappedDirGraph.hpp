@@ -48,9 +48,16 @@ namespace sutil
    * NOTE 2 : You MUST set the name_ and parent_names_ fields for the objects
    *          in the mapped graph. The linkNodes function requires this
    *          to organize your (unordered) list of nodes into a graph.
+   *
+   * NOTE 3 : The Alloc, Index, Stats, Rank and NodeTable arguments are
+   *          passed on to the CMappedTree.
    */
-  template <typename TIdx, typename TNode>
-  class CMappedDirGraph : public sutil::CMappedTree<TIdx,TNode>
+  template <typename TIdx, typename TNode, typename Alloc = CMappedListAllocNew<TIdx,TNode>,
+            typename Index = CMappedListIndexMap<TIdx,TNode>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<TIdx,TNode>,
+            typename NodeTable = CMappedListNodeTableNone<TIdx,TNode> >
+  class CMappedDirGraph : public sutil::CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>
   {
   public:
     /** These are the edges broken while creating the spanning tree
@@ -60,18 +67,43 @@ namespace sutil
     /** Base class to simplify graph node specification (parent pointers etc.) */
     struct SMGNodeBase;
 
-    CMappedDirGraph() : CMappedTree<TIdx,TNode>::CMappedTree() { st_broken_edges_.clear(); }
+    CMappedDirGraph() : CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::CMappedTree() { st_broken_edges_.clear(); }
 
     /** Copy Constructor : Performs a deep-copy (std container requirement).
      * 'explicit' makes sure that only a CMappedDirGraph can be copied. Ie. Implicit
      * copy-constructor use is disallowed.*/
-    explicit CMappedDirGraph(const CMappedDirGraph<TIdx,TNode>& arg_dg) :
+    explicit CMappedDirGraph(const CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_dg) :
         st_broken_edges_(arg_dg.st_broken_edges_)
     {
-      const CMappedTree<TIdx,TNode> &tmp_ref = arg_dg;
-      CMappedTree<TIdx,TNode>::deepCopy(&tmp_ref);
+      const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable> &tmp_ref = arg_dg;
+      CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::deepCopy(&tmp_ref);
+    }
+
+    /** Move Constructor : Takes over the passed graph's nodes (and its
+     * broken edges) in O(1). The passed graph is left empty. */
+    CMappedDirGraph(CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_dg) noexcept :
+        CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::CMappedTree()
+    { CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_dg); }
+
+    /** Move assignment : Clears this graph and takes over the passed
+     * graph's nodes in O(1). The passed graph is left empty. */
+    CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
+    {
+      if(this != &arg_rhs)
+      {
+        clear();
+        CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_rhs);
+      }
+      return *this;
     }
 
+    /** Swaps the nodes (and the spanning tree's broken edges) with
+     * the passed graph. O(1). */
+    void swap(CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_swap_obj) noexcept
+    {
+      CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_swap_obj);
+      st_broken_edges_.swap(arg_swap_obj.st_broken_edges_);
+    }
 
     virtual ~CMappedDirGraph() { }
 
@@ -83,11 +115,45 @@ namespace sutil
 
     /** Clears all elements from the tree */
     virtual bool clear();
+
+  protected:
+    /** Translates the tree links, then the graph links and the broken
+     * edges, of freshly cloned nodes (see CMappedTree::remapClonedLinks) */
+    virtual bool remapClonedLinks(const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_src,
+        const CMappedListPtrTable<SMLNode<TIdx,TNode>*>& arg_remap);
   }; //End of template class
 
+  /** A CMappedDirGraph that can't be derived from, so that calls on it
+   * aren't virtual and can be inlined (see CMappedListFinal). The
+   * behaviour is the same as a CMappedDirGraph's. */
+  template <typename TIdx, typename TNode, typename Alloc = CMappedListAllocNew<TIdx,TNode>,
+            typename Index = CMappedListIndexMap<TIdx,TNode>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<TIdx,TNode>,
+            typename NodeTable = CMappedListNodeTableNone<TIdx,TNode> >
+  class CMappedDirGraphFinal final : public CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>
+  {
+    typedef CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable> base;
+  public:
+    CMappedDirGraphFinal() : base() {}
+
+    /** Copy Constructor : Performs a deep-copy (see CMappedDirGraph) */
+    explicit CMappedDirGraphFinal(const CMappedDirGraphFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_dg) :
+        base(arg_dg) {}
+
+    /** Move Constructor : Takes over the passed graph's nodes in O(1) */
+    CMappedDirGraphFinal(CMappedDirGraphFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_dg) noexcept :
+        base(std::move(arg_dg)) {}
+
+    CMappedDirGraphFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedDirGraphFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
+    { base::operator = (std::move(arg_rhs)); return *this; }
+
+    virtual ~CMappedDirGraphFinal() {}
+  };
+
   /** Node type base class (sets all the pointers etc. that will be required */
-  template <typename TIdx, typename TNode>
-  struct CMappedDirGraph<TIdx,TNode>::SMGNodeBase : public CMappedTree<TIdx,TNode>::SMTNodeBase
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  struct CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::SMGNodeBase : public CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::SMTNodeBase
   {
   public:
     /** The parent indices in the graph */
@@ -98,7 +164,7 @@ namespace sutil
     std::vector<TNode*> gr_child_addrs_;
 
     /** Constructor. Sets stuff to NULL */
-    SMGNodeBase() : CMappedTree<TIdx,TNode>::SMTNodeBase()
+    SMGNodeBase() : CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::SMTNodeBase()
     {
       gr_parent_names_.clear();
       gr_parent_addrs_.clear();
@@ -115,13 +181,13 @@ namespace sutil
    *
    * O(n*log(n))
    */
-  template <typename TIdx, typename TNode>
-  bool CMappedDirGraph<TIdx,TNode>::linkNodes()
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::linkNodes()
   {
     //Clear previous links (if any)
-    typename CMappedList<TIdx,TNode>::iterator it,ite;
-    for(it = CMappedList<TIdx,TNode>::begin(),
-        ite = CMappedList<TIdx,TNode>::end();
+    typename CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::iterator it,ite;
+    for(it = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(),
+        ite = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end();
         it != ite; ++it)
     {
       TNode& tmp_node = *it;
@@ -132,13 +198,13 @@ namespace sutil
     }
 
     //Form the new links for the graph
-    for(it = CMappedList<TIdx,TNode>::begin(), ite = CMappedList<TIdx,TNode>::end();
+    for(it = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(), ite = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end();
         it != ite; ++it)
     {
       TNode& tmp_node = *it;
       //Iterate over all nodes and connect them to their
       //parents
-      if(&tmp_node == CMappedTree<TIdx,TNode>::root_node_)
+      if(&tmp_node == CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::root_node_)
       {//No parents
         continue;
       }
@@ -148,7 +214,7 @@ namespace sutil
         for(itp = tmp_node.gr_parent_names_.begin(), itpe = tmp_node.gr_parent_names_.end();
             itp!=itpe;++itp)
         {
-          TNode * tmp_node2add = sutil::CMappedList<TIdx,TNode>::at(*itp);
+          TNode * tmp_node2add = sutil::CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::at(*itp);
           if(tmp_node2add == NULL)
           {//No parent -- Ignore this node
 #ifdef DEBUG
@@ -172,11 +238,11 @@ namespace sutil
 
     //Now set up the spanning tree and affirm initialization is complete.
     bool flag = genSpanningTree();
-    CMappedTree<TIdx,TNode>::has_been_init_ = false; //Not done yet.
+    CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::has_been_init_ = false; //Not done yet.
 
     //Now compute the broken edges.
     st_broken_edges_.clear();
-    for(it = CMappedList<TIdx,TNode>::begin(), ite = CMappedList<TIdx,TNode>::end();
+    for(it = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(), ite = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end();
         it != ite; ++it)
     {
       TNode &tmp_node = *it;
@@ -185,7 +251,7 @@ namespace sutil
           itp!=itpe;++itp)
       {
         TIdx &pidx = *itp;
-        TNode* test_parent = CMappedList<TIdx,TNode>::at(pidx);
+        TNode* test_parent = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::at(pidx);
         if(test_parent != tmp_node.parent_addr_)
         {//Found a parent who is disconnected in the spanning tree
           std::pair<TNode*, TNode*> tmp_broken_edge;
@@ -196,40 +262,45 @@ namespace sutil
       }
     }
 
-    CMappedTree<TIdx,TNode>::has_been_init_ = true; //Finally done.
+    CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::has_been_init_ = true; //Finally done.
 
     //Return the end result
-    return CMappedTree<TIdx,TNode>::has_been_init_;
+    return CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::has_been_init_;
   }
 
   /** Generates the spanning tree for the graph and stores it in the mapped tree pointer structure
    *
-   * NOTE TODO : Make this function more efficient.
+   * NOTE : The numeric index lookups use the mapped list's position
+   *        cache, so each pass over the nodes is linear in the number
+   *        of edges.
    */
-  template <typename TIdx, typename TNode>
-  bool CMappedDirGraph<TIdx,TNode>::genSpanningTree()
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::genSpanningTree()
   {
     // Must have a root node to be able to create the spanning tree.
     // NOTE TODO : Potentially eliminate this requirement and pick a suitable root node.
-    TNode* root = CMappedTree<TIdx,TNode>::getRootNode();
+    TNode* root = CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::getRootNode();
     if(NULL == root)
     { return false; }
 
-    int graph_sz = CMappedList<TIdx,TNode>::size();
+    //Rebuild the position cache once so the lookups below are O(1)
+    CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cachePositions();
+
+    int graph_sz = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::size();
 
     struct SSTreeStruct{  bool in_stree_; TNode* node_; };
     SSTreeStruct *in_stree = new SSTreeStruct[graph_sz];
 
     //First populate the node pointers (create a temp data struct to store stuff).
-    typename CMappedTree<TIdx,TNode>::iterator it,ite;
+    typename CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::iterator it,ite;
     int i=0;
-    for(it = CMappedTree<TIdx,TNode>::begin(), ite = CMappedTree<TIdx,TNode>::end(); it!=ite; ++it)
+    for(it = CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(), ite = CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end(); it!=ite; ++it)
     {
       //Get the node's numeric index in the underlying mapped list.
-      i = CMappedList<TIdx,TNode>::getIndexNumericAt(&(*it));
+      i = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::getIndexNumericAt(&(*it));
       //Set values at corresponding position in the data struct array
       in_stree[i].node_ = &(*it);
-      if(CMappedTree<TIdx,TNode>::getRootNodeConst() == in_stree[i].node_)
+      if(CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::getRootNodeConst() == in_stree[i].node_)
       { in_stree[i].in_stree_ = true; }
       else
       { in_stree[i].in_stree_ = false;  }
@@ -251,7 +322,7 @@ namespace sutil
             itp!=itpe;++itp)
         {
           TIdx &pidx = *itp;
-          int pnidx = CMappedList<TIdx,TNode>::getIndexNumericAt(pidx); //numeric parent index
+          int pnidx = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::getIndexNumericAt(pidx); //numeric parent index
 #ifdef DEBUG
           assert(-1 != pnidx);
 #endif
@@ -271,20 +342,71 @@ namespace sutil
       { complete = (complete && in_stree[i].in_stree_); }
 
       if(false == complete && nodes_in_stree_curr == nodes_in_stree_pre)
-      { return false; }//Could not add any node this time. And not complete. Algo is stuck.
+      { delete [] in_stree; return false; }//Could not add any node this time. And not complete. Algo is stuck.
       else
       { nodes_in_stree_pre = nodes_in_stree_curr; }
     }
 
+    delete [] in_stree;
+
     //Start at the root node (which has, presumably, been set)
-    return CMappedTree<TIdx,TNode>::linkNodes();
+    return CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::linkNodes();
+  }
+
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::
+  remapClonedLinks(const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_src,
+      const CMappedListPtrTable<SMLNode<TIdx,TNode>*>& arg_remap)
+  {
+    const CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>* src =
+        dynamic_cast<const CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>*>(&arg_src);
+    if(NULL == src)
+    {//Not cloned from a graph. Link by name.
+      return linkNodes();
+    }
+
+    if(false == CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::remapClonedLinks(arg_src, arg_remap))
+    { return false; }
+
+    typename CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::iterator it,ite;
+    for(it = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(),
+        ite = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end();
+        it != ite; ++it)
+    {
+      TNode& tmp_node = *it;
+      typename std::vector<TNode*>::iterator itg,itge;
+      for(itg = tmp_node.gr_parent_addrs_.begin(), itge = tmp_node.gr_parent_addrs_.end();
+          itg!=itge; ++itg)
+      {
+        *itg = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cloneRemap(arg_remap, *itg);
+        if(NULL == *itg) { return false; }
+      }
+      for(itg = tmp_node.gr_child_addrs_.begin(), itge = tmp_node.gr_child_addrs_.end();
+          itg!=itge; ++itg)
+      {
+        *itg = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cloneRemap(arg_remap, *itg);
+        if(NULL == *itg) { return false; }
+      }
+    }
+
+    st_broken_edges_.clear();
+    st_broken_edges_.reserve(src->st_broken_edges_.size());
+    typename std::vector<std::pair<TNode*, TNode*> >::const_iterator itb,itbe;
+    for(itb = src->st_broken_edges_.begin(), itbe = src->st_broken_edges_.end();
+        itb!=itbe; ++itb)
+    {
+      st_broken_edges_.push_back(std::pair<TNode*, TNode*>(
+          CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cloneRemap(arg_remap, itb->first),
+          CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cloneRemap(arg_remap, itb->second)));
+    }
+    return true;
   }
 
   /** Clears all elements from the tree */
-  template <typename TIdx, typename TNode>
-  bool CMappedDirGraph<TIdx,TNode>::clear()
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedDirGraph<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::clear()
   {
-    bool flag = CMappedTree<TIdx,TNode>::clear();
+    bool flag = CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::clear();
     if(flag)
     { st_broken_edges_.clear(); }
     return flag;
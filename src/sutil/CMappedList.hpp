@@ -15,6 +15,9 @@ See the Readme.txt file in the root folder for licensing information.
 #include <map>
 #include <cstddef>
 #include <vector>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
 
 #ifdef DEBUG
 #include <iostream>
@@ -44,6 +47,482 @@ namespace sutil
     }
   };
 
+  /** The default node allocation policy for a CMappedList.
+   *
+   * Allocates the node, its data and its index separately on
+   * the heap (three news per create and three deletes per erase).
+   *
+   * An allocation policy must implement:
+   * (a) createNode(idx, args...) : Returns a node with a T constructed
+   *                          from args and a copy of (or the moved) idx
+   * (b) adoptNode(idx, t*) : Returns a node that owns the passed t*
+   *                          (which must have been allocated with new)
+   * (c) destroyNode(node)  : Deallocates a node, its data and its index
+   * (d) swap(alloc)        : Exchanges all allocated memory with another
+   *                          allocator (required to swap or move mapped
+   *                          lists). Delete it if the nodes can't change
+   *                          hands, so swapping or moving won't compile.
+   * (e) reserve(n)         : Prepares for n more nodes (may do nothing)
+   *
+   * The create and adopt functions return NULL if they fail. The allocator
+   * must never move a node's data (mapped lists guarantee pointer stability). */
+  template <typename Idx, typename T>
+  class CMappedListAllocNew
+  {
+  public:
+    template <typename I, typename... Args>
+    SMLNode<Idx,T>* createNode(I&& arg_idx, Args&&... arg_args)
+    {
+      SMLNode<Idx,T>* node = new SMLNode<Idx,T>();
+      if(NULL == node) { return NULL; }
+      node->data_ = new T(std::forward<Args>(arg_args)...);
+      node->id_ = new Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    template <typename I>
+    SMLNode<Idx,T>* adoptNode(I&& arg_idx, T* arg_t)
+    {
+      SMLNode<Idx,T>* node = new SMLNode<Idx,T>();
+      if(NULL == node) { return NULL; }
+      node->data_ = arg_t;
+      node->id_ = new Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    void destroyNode(SMLNode<Idx,T>* arg_node)
+    {
+      if(NULL!=arg_node->data_)
+      { delete arg_node->data_;  }
+      if(NULL!=arg_node->id_)
+      { delete arg_node->id_;  }
+      delete arg_node;
+    }
+
+    /** Nothing to swap. All the memory is on the heap. */
+    void swap(CMappedListAllocNew<Idx,T>& arg_swap_obj) {}
+
+    /** Each node is a separate heap allocation. Nothing to do. */
+    void reserve(const std::size_t arg_n) {}
+  };
+
+  /** The default index policy for a CMappedList. Looks up
+   * nodes with a std::map (O(log n) compares per lookup).
+   *
+   * An index policy must implement:
+   * (a) find(idx)         : Returns the node for idx (NULL if absent)
+   * (b) insert(idx, node) : Adds a node. Returns false if idx exists
+   * (c) erase(idx)        : Removes idx. Returns false if idx is absent
+   * (d) clear(), size()   : As with std containers
+   * (e) reserve(n)        : Prepares for n entries (may do nothing)
+   * (f) swap(index)       : Exchanges all entries with another index
+   * (g) insertHinted(idx, node) : Same as insert, but may be faster when
+   *                         called with keys in ascending order (bulk loads)
+   * (h) cloneFrom(index, remap) : Becomes a copy of another (list's) index,
+   *                         with each node replaced by remap(node). Used
+   *                         to clone lists without re-inserting every key
+   *
+   * Ordered indices may also implement (for the list's key range queries) :
+   * (i) const_iterator, begin(), end(), lower_bound(idx), upper_bound(idx) :
+   *                         As with a std::map<Idx, SMLNode<Idx,T>*>
+   *
+   * The index doesn't own the nodes. It may (and the hash index does)
+   * read a node's id_ to compare keys. */
+  template <typename Idx, typename T>
+  class CMappedListIndexMap
+  {
+  public:
+    /** Iterates over the entries in key order */
+    typedef typename std::map<Idx, SMLNode<Idx,T>*>::const_iterator const_iterator;
+
+    SMLNode<Idx,T>* find(const Idx& arg_idx) const
+    {
+      typename std::map<Idx, SMLNode<Idx,T>*>::const_iterator it = map_.find(arg_idx);
+      if(it == map_.end()) { return NULL; }
+      return it->second;
+    }
+
+    bool insert(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    { return map_.insert(std::pair<Idx, SMLNode<Idx,T>*>(arg_idx, arg_node)).second; }
+
+    /** Hints the insert at the end of the map. This is amortized O(1)
+     * when the keys arrive in ascending order (and larger than the
+     * keys already in the map). */
+    bool insertHinted(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    {
+      typename std::map<Idx, SMLNode<Idx,T>*>::iterator it = map_.insert(map_.end(),
+          std::pair<Idx, SMLNode<Idx,T>*>(arg_idx, arg_node));
+      return (it->second == arg_node);
+    }
+
+    bool erase(const Idx& arg_idx)
+    { return (0 < map_.erase(arg_idx)); }
+
+    void clear()
+    { map_.clear(); }
+
+    std::size_t size() const
+    { return map_.size(); }
+
+    /** A std::map can't preallocate. Nothing to do. */
+    void reserve(const std::size_t arg_n) {}
+
+    void swap(CMappedListIndexMap<Idx,T>& arg_swap_obj)
+    { map_.swap(arg_swap_obj.map_); }
+
+    /** Copies the passed map's tree (O(n), without comparing any keys)
+     * and points each entry at remap(node). Returns false (and leaves
+     * the index empty) if a node can't be remapped. */
+    template <typename Remap>
+    bool cloneFrom(const CMappedListIndexMap<Idx,T>& arg_src, const Remap& arg_remap)
+    {
+      map_ = arg_src.map_;
+      typename std::map<Idx, SMLNode<Idx,T>*>::iterator it,ite;
+      for(it = map_.begin(), ite = map_.end(); it!=ite; ++it)
+      {
+        it->second = arg_remap(it->second);
+        if(NULL == it->second) { map_.clear(); return false; }
+      }
+      return true;
+    }
+
+    const_iterator begin() const
+    { return map_.begin(); }
+
+    const_iterator end() const
+    { return map_.end(); }
+
+    /** The first entry whose key isn't less than idx */
+    const_iterator lower_bound(const Idx& arg_idx) const
+    { return map_.lower_bound(arg_idx); }
+
+    /** The first entry whose key is greater than idx */
+    const_iterator upper_bound(const Idx& arg_idx) const
+    { return map_.upper_bound(arg_idx); }
+
+  private:
+    std::map<Idx, SMLNode<Idx,T>*> map_;
+  };
+
+  /** Iterates over a CMappedList's elements in key order, by walking an
+   * ordered index (see CMappedList::lower_bound). Nothing is copied.
+   *
+   * IdxIt is the index's const_iterator (whose entries are
+   * <Idx, SMLNode*> pairs). TOut is T, or const T for const lists.
+   *
+   * NOTE : Creating and erasing elements invalidates the iterators
+   *        (like a std::map's, if the index is a std::map). */
+  template <typename Idx, typename T, typename TOut, typename IdxIt>
+  class CMappedListKeyIterator : public std::iterator<std::bidirectional_iterator_tag, TOut>
+  {
+    IdxIt it_;
+  public:
+    CMappedListKeyIterator() {}
+
+    explicit CMappedListKeyIterator(const IdxIt& arg_it) : it_(arg_it) {}
+
+    /** So that : key_const_iterator x = key_iterator(); */
+    template <typename TOut2>
+    CMappedListKeyIterator(const CMappedListKeyIterator<Idx,T,TOut2,IdxIt>& arg_other) :
+      it_(arg_other.getIndexIterator()) {}
+
+    bool operator == (const CMappedListKeyIterator& arg_other) const
+    { return it_ == arg_other.it_; }
+
+    bool operator != (const CMappedListKeyIterator& arg_other) const
+    { return it_ != arg_other.it_; }
+
+    TOut& operator * () const
+    { return *(it_->second->data_); }
+
+    TOut* operator -> () const
+    { return it_->second->data_; }
+
+    /** The element's Idx (as with the list's iterators) */
+    const Idx& operator ! () const
+    { return *(it_->second->id_); }
+
+    const Idx& getIdx() const
+    { return *(it_->second->id_); }
+
+    CMappedListKeyIterator& operator ++ ()
+    { ++it_; return *this; }
+
+    CMappedListKeyIterator operator ++ (int)
+    { CMappedListKeyIterator tmp(*this); ++it_; return tmp; }
+
+    CMappedListKeyIterator& operator -- ()
+    { --it_; return *this; }
+
+    CMappedListKeyIterator operator -- (int)
+    { CMappedListKeyIterator tmp(*this); --it_; return tmp; }
+
+    /** The underlying index iterator */
+    const IdxIt& getIndexIterator() const
+    { return it_; }
+  };
+
+  /** The default stats policy for a CMappedList. Counts nothing; its
+   * empty inline hooks compile away.
+   *
+   * A stats policy must implement (the list calls them as it works):
+   * (a) onCreate()        : A node was added (create, insert, bulk loads)
+   * (b) onErase()         : A node was erased (erase by Idx or pointer)
+   * (c) onLookup()        : An Idx lookup (at(Idx), at_const(Idx), erase(Idx))
+   * (d) onPosLookup()     : A positional lookup (at(size_t), getIndexAt etc.)
+   * (e) onWalk(n)         : n nodes were walked (eg. to rebuild the
+   *                         position cache after a change)
+   * (f) onAlloc(bytes)    : A node (with its Idx and T) was allocated
+   * (g) onFree(bytes)     : A node (with its Idx and T) was deallocated
+   *
+   * The hooks are called from const methods too, so they must be const.
+   * Use CMappedListStatsCount (in CMappedListStats.hpp) to count. */
+  class CMappedListStatsNone
+  {
+  public:
+    void onCreate() const {}
+    void onErase() const {}
+    void onLookup() const {}
+    void onPosLookup() const {}
+    void onWalk(const std::size_t arg_n) const {}
+    void onAlloc(const std::size_t arg_bytes) const {}
+    void onFree(const std::size_t arg_bytes) const {}
+  };
+
+  /** A CMappedList rank policy keeps (or doesn't keep) a layer over the
+   * node list that finds positions in O(log n) even while the list is
+   * changing. It must provide:
+   * (a) Indexed           : A static const bool. If false, the list uses
+   *                         its position cache (O(1) lookups, but O(n)
+   *                         after every create/erase) and the iterators
+   *                         step one node at a time.
+   * (b) onLink(node, at_start, front, size)
+   *                       : The node was linked at the front (or back).
+   *                         front and size are the list's, after linking.
+   * (c) onUnlink(node, front, size)
+   *                       : The node was unlinked (front and size after).
+   * (d) onReorder(front, size) : The list was reordered (eg. sorted)
+   * (e) nodeAt(pos)       : The node at a position (pos < size)
+   * (f) positionOf(node, ret_pos) : A node's position. False if absent.
+   * (g) clear(), reserve(n), swap(other)
+   *
+   * This one keeps nothing and costs nothing. Use a
+   * CMappedListRankFenwick (in CMappedListRank.hpp) to jump into the
+   * middle of large lists that change often. */
+  template <typename Idx, typename T>
+  class CMappedListRankNone
+  {
+  public:
+    static const bool Indexed = false;
+
+    void onLink(SMLNode<Idx,T>* arg_node, const bool arg_at_start,
+        SMLNode<Idx,T>* arg_front, const std::size_t arg_size) {}
+    void onUnlink(SMLNode<Idx,T>* arg_node, SMLNode<Idx,T>* arg_front,
+        const std::size_t arg_size) {}
+    void onReorder(SMLNode<Idx,T>* arg_front, const std::size_t arg_size) {}
+    SMLNode<Idx,T>* nodeAt(const std::size_t arg_pos) const { return NULL; }
+    bool positionOf(const SMLNode<Idx,T>* arg_node, std::size_t& ret_pos) const { return false; }
+    void clear() {}
+    void reserve(const std::size_t arg_n) {}
+    void swap(CMappedListRankNone<Idx,T>& arg_swap_obj) {}
+  };
+
+  /** An open-addressing (linear probing) hash table that maps
+   * pointers to values. CMappedList uses it to look up a data
+   * pointer's position in O(1).
+   *
+   * NULL can't be used as a key. */
+  template <typename TVal>
+  class CMappedListPtrTable
+  {
+  public:
+    CMappedListPtrTable() : mask_(0), size_(0) {}
+
+    /** Returns the value in ret_val. False if the key is absent. */
+    bool find(const void* arg_key, TVal& ret_val) const
+    {
+      if(0 == size_ || NULL == arg_key) { return false; }
+      for(std::size_t i = hashOf(arg_key) & mask_; ; i = (i+1) & mask_)
+      {
+        if(NULL == slots_[i].key_) { return false; }
+        if(arg_key == slots_[i].key_)
+        { ret_val = slots_[i].val_; return true; }
+      }
+    }
+
+    /** Adds (or overwrites) a key's value */
+    bool insert(const void* arg_key, const TVal& arg_val)
+    {
+      if(NULL == arg_key) { return false; }
+      if((size_+1)*4 > slots_.size()*3)
+      { rehash(slots_.size() < 16 ? 16 : slots_.size()*2); }
+
+      std::size_t i = hashOf(arg_key) & mask_;
+      for(; NULL != slots_[i].key_; i = (i+1) & mask_)
+      {
+        if(arg_key == slots_[i].key_)
+        { slots_[i].val_ = arg_val; return true; }
+      }
+      slots_[i].key_ = arg_key;
+      slots_[i].val_ = arg_val;
+      size_++;
+      return true;
+    }
+
+    bool erase(const void* arg_key)
+    {
+      if(0 == size_ || NULL == arg_key) { return false; }
+      std::size_t i = hashOf(arg_key) & mask_;
+      for(; arg_key != slots_[i].key_; i = (i+1) & mask_)
+      { if(NULL == slots_[i].key_) { return false; } }
+
+      //Shift later entries in the probe sequence back into the hole
+      for(std::size_t j = (i+1) & mask_; NULL != slots_[j].key_; j = (j+1) & mask_)
+      {
+        std::size_t home = hashOf(slots_[j].key_) & mask_;
+        bool can_move = (i <= j) ? (home <= i || home > j) : (home <= i && home > j);
+        if(can_move)
+        { slots_[i] = slots_[j]; i = j; }
+      }
+      slots_[i].key_ = NULL;
+      size_--;
+      return true;
+    }
+
+    /** Removes all the entries (but keeps the table's memory) */
+    void clear()
+    {
+      for(std::size_t i=0; i<slots_.size(); ++i)
+      { slots_[i].key_ = NULL; }
+      size_ = 0;
+    }
+
+    std::size_t size() const
+    { return size_; }
+
+    /** Grows the table so that n entries fit without a rehash */
+    void reserve(const std::size_t arg_n)
+    {
+      std::size_t cap = slots_.size() < 16 ? 16 : slots_.size();
+      while(arg_n*4 > cap*3) { cap *= 2; }
+      if(cap > slots_.size()) { rehash(cap); }
+    }
+
+    void swap(CMappedListPtrTable<TVal>& arg_swap_obj)
+    {
+      slots_.swap(arg_swap_obj.slots_);
+      std::size_t t = mask_; mask_ = arg_swap_obj.mask_; arg_swap_obj.mask_ = t;
+      t = size_; size_ = arg_swap_obj.size_; arg_swap_obj.size_ = t;
+    }
+
+  private:
+    struct SSlot
+    {
+      const void* key_;
+      TVal val_;
+      SSlot() : key_(NULL), val_() {}
+    };
+
+    static std::size_t hashOf(const void* arg_key)
+    {
+      unsigned long long h = static_cast<unsigned long long>(
+          reinterpret_cast<std::size_t>(arg_key));
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      return static_cast<std::size_t>(h);
+    }
+
+    void rehash(const std::size_t arg_cap)
+    {
+      std::vector<SSlot> old(arg_cap);
+      old.swap(slots_);
+      mask_ = arg_cap - 1;
+      for(std::size_t k=0; k<old.size(); ++k)
+      {
+        if(NULL == old[k].key_) { continue; }
+        std::size_t i = hashOf(old[k].key_) & mask_;
+        while(NULL != slots_[i].key_) { i = (i+1) & mask_; }
+        slots_[i] = old[k];
+      }
+    }
+
+    std::vector<SSlot> slots_;
+    std::size_t mask_;
+    std::size_t size_;
+  };
+
+  /** A CMappedList node table policy finds the node that holds an
+   * element, given the element's address (for erase(const T*),
+   * reindex(const T*) and rank lookups by pointer). It must provide:
+   * (a) Enabled           : A static const bool. If false, the list
+   *                         walks its nodes instead of calling find().
+   * (b) onLink(node)      : The node was linked into the list
+   * (c) onUnlink(node)    : The node was unlinked from the list
+   * (d) find(t, ret_node) : The node that holds t. False if absent.
+   * (e) clear(), reserve(n), swap(other)
+   *
+   * This one keeps nothing and costs nothing, so finding a node by
+   * pointer is O(n). Use a CMappedListNodeTableHash if the list is
+   * often erased (or reindexed) by pointer. */
+  template <typename Idx, typename T>
+  class CMappedListNodeTableNone
+  {
+  public:
+    static const bool Enabled = false;
+
+    void onLink(SMLNode<Idx,T>* arg_node) {}
+    void onUnlink(SMLNode<Idx,T>* arg_node) {}
+    bool find(const T* arg_t, SMLNode<Idx,T>*& ret_node) const { return false; }
+    void clear() {}
+    void reserve(const std::size_t arg_n) {}
+    void swap(CMappedListNodeTableNone<Idx,T>& arg_swap_obj) {}
+  };
+
+  /** A node table policy that hashes each element's address to its
+   * node. Finding a node by pointer is O(1), at the cost of a hash
+   * insert per create, a hash erase per erase and a slot per node.
+   *
+   * Usage:
+   *   sutil::CMappedList<int, SBody, sutil::CMappedListAllocNew<int,SBody>,
+   *     sutil::CMappedListIndexMap<int,SBody>, sutil::CMappedListStatsNone,
+   *     sutil::CMappedListRankNone<int,SBody>,
+   *     sutil::CMappedListNodeTableHash<int,SBody> > bodies;
+   *   bodies.erase(b); //O(1) */
+  template <typename Idx, typename T>
+  class CMappedListNodeTableHash
+  {
+  public:
+    static const bool Enabled = true;
+
+    void onLink(SMLNode<Idx,T>* arg_node)
+    {
+      if(NULL != arg_node->data_)
+      { table_.insert(static_cast<const void*>(arg_node->data_), arg_node); }
+    }
+
+    void onUnlink(SMLNode<Idx,T>* arg_node)
+    {
+      if(NULL != arg_node->data_)
+      { table_.erase(static_cast<const void*>(arg_node->data_)); }
+    }
+
+    bool find(const T* arg_t, SMLNode<Idx,T>*& ret_node) const
+    { return table_.find(static_cast<const void*>(arg_t), ret_node); }
+
+    void clear()
+    { table_.clear(); }
+
+    void reserve(const std::size_t arg_n)
+    { table_.reserve(arg_n); }
+
+    void swap(CMappedListNodeTableHash<Idx,T>& arg_swap_obj)
+    { table_.swap(arg_swap_obj.table_); }
+
+  private:
+    CMappedListPtrTable<SMLNode<Idx,T>*> table_;
+  };
+
   /** A linked list to allocate memory for objects and
    * store them, allowing pointer access.
    *
@@ -63,8 +542,38 @@ namespace sutil
    * (c) You don't want to manage either map access or memory for
    *     contained objects
    * (d) You want the leanest possible code that does the above
+   *
+   * The Alloc template argument sets how nodes are allocated. The
+   * default allocates each node on the heap. Use a CMappedListAllocSlab
+   * (in CMappedListAllocSlab.hpp) to allocate nodes from a chunked pool
+   * if you create and erase nodes at a high rate.
+   *
+   * The Index template argument sets how nodes are looked up by Idx.
+   * The default uses a std::map. Use a CMappedListIndexHash (in
+   * CMappedListIndexHash.hpp) for O(1) lookups on large lists.
+   *
+   * The Stats template argument counts what the list does (creates,
+   * lookups, nodes walked, bytes held etc.). The default counts nothing
+   * and costs nothing. Use a CMappedListStatsCount (in
+   * CMappedListStats.hpp) to find O(n) calls in time critical code.
+   *
+   * The Rank template argument sets how positions are found. The
+   * default uses the position cache, which is O(1) but is rebuilt in
+   * O(n) after every create/erase. Use a CMappedListRankFenwick (in
+   * CMappedListRank.hpp) for O(log n) positional access, position
+   * lookups and iterator jumps (it + n) that stay fast while the list
+   * changes. Its iterators are random access.
+   *
+   * The NodeTable template argument sets how an element's node is found
+   * from its address. The default keeps nothing, so erase(const T*) and
+   * reindex() walk the list. Use a CMappedListNodeTableHash to make
+   * them O(1) (each create and erase then also updates a hash table).
    */
-  template <typename Idx, typename T>
+  template <typename Idx, typename T, typename Alloc = CMappedListAllocNew<Idx,T>,
+            typename Index = CMappedListIndexMap<Idx,T>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<Idx,T>,
+            typename NodeTable = CMappedListNodeTableNone<Idx,T> >
   class CMappedList
   {
   public:
@@ -96,19 +605,22 @@ namespace sutil
      * The standard methods
      * ************************** */
     /** Constructor : Resets the pilemap. */
-    CMappedList() : front_(NULL), back_(NULL), size_(0), flag_is_sorted_(false) {}
+    CMappedList() : front_(NULL), back_(NULL), size_(0), flag_is_sorted_(false),
+        flag_pos_valid_(false), version_(0) {}
 
   protected:
     /** Does a deep copy of the mappedlist to
-     * get a new one. This is VERY SLOW. */
-    virtual bool deepCopy(const CMappedList<Idx,T>* const arg_pmap);
+     * get a new one. Uses cloneNodes(), so the copy keeps the
+     * passed list's order and its index isn't rebuilt key by key. */
+    virtual bool deepCopy(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* const arg_pmap);
 
   public:
     /** Copy Constructor : Performs a deep-copy (std container requirement).
      * Beware; This can be quite slow.
      * 'explicit' makes sure that only a CMappedList can be copied. Ie. Implicit
      * copy-constructor use is disallowed.*/
-    explicit CMappedList(const CMappedList<Idx,T>& arg_pm)
+    explicit CMappedList(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_pm) :
+        flag_is_sorted_(false), flag_pos_valid_(false), version_(0)
     {
       front_ = NULL; back_ = NULL; null_.prev_ = NULL; size_ = 0;
       deepCopy(&arg_pm);
@@ -116,26 +628,46 @@ namespace sutil
 
     /** Assignment operator : Performs a deep-copy (std container requirement).
      * Beware; This can be quite slow. */
-    virtual CMappedList<Idx,T>& operator = (const CMappedList<Idx,T>& arg_rhs)
+    virtual CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_rhs)
     {
       deepCopy(&arg_rhs);
       return *this;
     }
 
+    /** Move Constructor : Takes over the passed list's nodes in O(1). The
+     * passed list is left empty. Pointers to the elements remain valid. */
+    CMappedList(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_pm) noexcept :
+        front_(NULL), back_(NULL), size_(0), flag_is_sorted_(false),
+        flag_pos_valid_(false), version_(0)
+    { CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_pm); }
+
+    /** Move assignment : Clears this list and takes over the passed
+     * list's nodes in O(1). The passed list is left empty. */
+    CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
+    {
+      if(this != &arg_rhs)
+      {
+        CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::clear();
+        CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_rhs);
+      }
+      return *this;
+    }
+
     /** Destructor : Deallocates all the nodes if someone already hasn't
      * done so. */
     virtual ~CMappedList();
 
     /** Comparison operator : Performs an element-by-element check (std container requirement).
      * Beware; This can be quite slow. */
-    bool operator == (const CMappedList<Idx,T>& rhs);
+    bool operator == (const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& rhs);
 
     /** Comparison operator : Performs an element-by-element check (std container requirement).
      * Beware; This can be quite slow. */
-    bool operator != (const CMappedList<Idx,T>& rhs);
+    bool operator != (const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& rhs);
 
-    /** Swaps the elements with the passed pilemap */
-    void swap(CMappedList<Idx,T>& arg_swap_obj);
+    /** Swaps the elements with the passed pilemap. O(1) : Only
+     * swaps pointers (the nodes themselves don't move). */
+    void swap(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_swap_obj) noexcept;
 
 //    /** Example usage:
 //     *   first.assign (7,100);                      // 7 ints with value 100
@@ -149,7 +681,8 @@ namespace sutil
   public:
 
     /** Creates an element, inserts an element into the list
-     * and returns the pointer   */
+     * and returns the pointer. The element is default constructed
+     * in place (no copies).   */
     virtual T* create(const Idx & arg_idx, const bool insert_at_start=true);
 
     /** Copies the given element, inserts the copied element into the list
@@ -159,30 +692,98 @@ namespace sutil
      * flag is false, inserts at the end of the list. */
     virtual T* create(const Idx & arg_idx, const T& arg_t, const bool insert_at_start=true);
 
+    /** Moves the given element (and index) into the list and returns the
+     * pointer to the stored element. Use this for temporaries and for
+     * heavy objects you don't need any more.
+     *
+     * By default inserts element at the start/begin() position. If specified,
+     * flag is false, inserts at the end of the list.
+     *
+     * NOTE : This only accepts an rvalue T (U must be T). Lvalues and other
+     *        types (eg. a bool flag) go to the overloads above, as before. */
+    template <typename U>
+    typename std::enable_if<std::is_same<U,T>::value, T*>::type
+    create(Idx && arg_idx, U&& arg_t, const bool insert_at_start=true)
+    { return emplaceAt(insert_at_start, std::move(arg_idx), std::move(arg_t)); }
+
+    /** Constructs an element in place from the passed constructor
+     * arguments, inserts it at the start of the list and returns its
+     * pointer. Returns NULL if the index already exists.
+     *
+     * Eg. list.emplace("vec", 100, 0.0); //Stores std::vector<double>(100,0.0) */
+    template <typename... Args>
+    T* emplace(const Idx & arg_idx, Args&&... arg_args)
+    { return emplaceAt(true, arg_idx, std::forward<Args>(arg_args)...); }
+
+    template <typename... Args>
+    T* emplace(Idx && arg_idx, Args&&... arg_args)
+    { return emplaceAt(true, std::move(arg_idx), std::forward<Args>(arg_args)...); }
+
+    /** Same as emplace, but inserts the element at the end of the list */
+    template <typename... Args>
+    T* emplace_back(const Idx & arg_idx, Args&&... arg_args)
+    { return emplaceAt(false, arg_idx, std::forward<Args>(arg_args)...); }
+
+    template <typename... Args>
+    T* emplace_back(Idx && arg_idx, Args&&... arg_args)
+    { return emplaceAt(false, std::move(arg_idx), std::forward<Args>(arg_args)...); }
+
+    /** Bulk load : Creates one element for each (Idx, T) pair (anything
+     * with .first and .second) in [arg_first, arg_last), and appends
+     * them to the end of the list in the range's order.
+     *
+     * The allocator and index are sized once, repeated indices are found
+     * in one sorted pass, and the index is built in sorted order. Pass
+     * std::move_iterators to move the pairs in instead of copying them.
+     *
+     * Returns false (and adds nothing) if an index is repeated in the
+     * range or already exists in the list.
+     *
+     * NOTE : Idx must support operator <. */
+    template <typename ForwardIt>
+    bool createRange(ForwardIt arg_first, ForwardIt arg_last)
+    { return createRangeImpl(arg_first, arg_last, NULL); }
+
+    /** Clears the list and bulk loads the passed range (see createRange) */
+    template <typename ForwardIt>
+    bool assign(ForwardIt arg_first, ForwardIt arg_last)
+    {
+      clear();
+      return createRangeImpl(arg_first, arg_last, NULL);
+    }
+
     /** Inserts the given object into the list and returns the pointer to the copied element.
      * NOTE : The recommended method is to use create. Else the object memory deallocation might
      * be ambiguous. Remember that the mapped list "always" clears its own data.
      *
      * By default inserts element at the start/begin() position. If specified,
-     * flag is false, inserts at the end of the list. */
+     * flag is false, inserts at the end of the list.
+     *
+     * Returns NULL if the Idx exists or the index refuses the element
+     * (eg. a unique secondary index). arg_t is then still the caller's. */
     virtual T* insert(const Idx & arg_idx, T* arg_t, const bool insert_at_start=true);
 
     /** Returns the element at the given numerical index
-     * in the linked list (usually useful only for
-     * debugging)
+     * in the linked list
      *
-     * NOTE : The index starts at 0   */
+     * NOTE : The index starts at 0. O(1), except for the first
+     *        call after a create/erase/sort/swap, which is O(n)
+     *        (it rebuilds the position cache, so it writes to the list).
+     *        O(log n) with an indexed rank policy. */
     virtual T* at(const std::size_t arg_idx);
 
     /** Returns the element referenced by the index
      *
-     * NOTE : This uses the std::map (and is somewhat slow) */
+     * NOTE : This uses the index (a std::map by default, which is somewhat slow) */
     virtual T* at(const Idx & arg_idx);
 
     /** Returns the typed index at the given numerical index
      * in the linked list
      *
-     * NOTE : The index starts at 0   */
+     * NOTE : The index starts at 0. Uses the position cache (O(1)), or
+     *        the rank policy (O(log n)) if it is indexed. If the cache
+     *        is stale, walks the list (O(n)) instead of rebuilding it.
+     *        Never writes to the list (see cachePositions). */
     virtual const Idx* getIndexAt(const std::size_t arg_idx) const;
 
     /** Returns the numeric index at the given typed index
@@ -194,31 +795,154 @@ namespace sutil
     /** Returns the numeric index at the given typed index
      * in the linked list
      *
-     * NOTE : The index starts at 0. Returns -1 if node not found.   */
+     * NOTE : The index starts at 0. Returns -1 if node not found.
+     *        Uses the position cache (O(1)), or the rank policy
+     *        if it is indexed (O(log n) with a node table to find the
+     *        node, else O(n)). If the cache is stale, walks
+     *        the list (O(n)) instead of rebuilding it. Never writes to
+     *        the list (see cachePositions). */
     virtual int getIndexNumericAt(const T* const arg_node) const;
 
     /** Returns the element at the given numerical index
-     * in the linked list (usually useful only for
-     * debugging)
+     * in the linked list
      *
-     * NOTE : The index starts at 0   */
+     * NOTE : The index starts at 0. O(1) if the position cache is
+     *        valid, else O(n) (it walks the list, and doesn't rebuild
+     *        the cache). O(log n) with an indexed rank policy. Never
+     *        writes to the list (see cachePositions). */
     virtual const T* at_const(const std::size_t arg_idx) const;
 
+    /** Rebuilds the position cache (O(n)) if a create/erase/sort/swap
+     * made it stale. The const positional queries (at_const(size_t),
+     * getIndexAt, getIndexNumericAt) then take O(1).
+     *
+     * Threading : The const functions never write to the list, so any
+     * number of threads may call them at once while no thread changes
+     * the list. Call this (from one thread) after the last change and
+     * before sharing the list, to make their positional lookups O(1).
+     * (A counting stats policy still updates its counters.) */
+    void cachePositions()
+    { updatePositions(); }
+
     /** Returns a const pointer to the element referenced by the index
      *
-     * NOTE : This uses the std::map (and is rather slow) */
+     * NOTE : This uses the index (a std::map by default, which is rather slow) */
     virtual const T* at_const(const Idx & arg_idx) const;
 
     /** Erases an element from the list.
-     * Referenced by the element's memory location   */
+     * Referenced by the element's memory location. O(1) with a
+     * CMappedListNodeTableHash, else walks the list.   */
     virtual bool erase(const T* arg_t);
 
     /** Erases an element from the list.
-     * Referenced by its std::map index
+     * Referenced by its Idx
      *
-     * NOTE : This uses the std::map (and is rather slow) */
+     * NOTE : This uses the index (a std::map by default, which is rather slow) */
     virtual bool erase(const Idx& arg_idx);
 
+    /** Erases every element for which arg_pred(const T&) is true, in one
+     * walk over the list. Each erased node costs one index erase (no
+     * lookup first) and an O(1) unlink. Returns the number erased.
+     *
+     * Usage:
+     *   links.erase_if([](const SLink& l){ return l.mass_ < 1e-6; });
+     *
+     * NOTE : Doesn't allocate, so fixed-capacity lists may call it in
+     *        real-time code. The list's order (and sortedness) is kept. */
+    template <typename Pred>
+    std::size_t erase_if(Pred arg_pred);
+
+    /** Erases the elements whose Idx is in [arg_first, arg_last). Keys
+     * that aren't in the list (or repeat) are skipped. Returns the
+     * number erased. */
+    template <typename ForwardIt>
+    std::size_t erase(ForwardIt arg_first, ForwardIt arg_last);
+
+    /** Iterators over the elements in key order. They need an ordered
+     * index (eg. the default CMappedListIndexMap); the range queries
+     * below don't compile with the hash, small or dense indices.
+     *
+     * Usage:
+     *   sutil::CMappedList<std::string,SLink>::key_iterator<> it,ite;
+     *   for(it = links.key_begin(), ite = links.key_end(); it!=ite; ++it)
+     *   { std::cout<<!it<<" : "<<it->mass_; } //Sorted by name */
+    template <typename I = Index>
+    using key_iterator = CMappedListKeyIterator<Idx,T,T,typename I::const_iterator>;
+    template <typename I = Index>
+    using key_const_iterator = CMappedListKeyIterator<Idx,T,const T,typename I::const_iterator>;
+
+    template <typename I = Index>
+    key_iterator<I> key_begin()
+    { return key_iterator<I>(map_.begin()); }
+    template <typename I = Index>
+    key_const_iterator<I> key_begin() const
+    { return key_const_iterator<I>(map_.begin()); }
+
+    template <typename I = Index>
+    key_iterator<I> key_end()
+    { return key_iterator<I>(map_.end()); }
+    template <typename I = Index>
+    key_const_iterator<I> key_end() const
+    { return key_const_iterator<I>(map_.end()); }
+
+    /** The first element whose Idx isn't less than arg_idx. O(log n). */
+    template <typename I = Index>
+    key_iterator<I> lower_bound(const Idx& arg_idx)
+    { stats_.onLookup(); return key_iterator<I>(map_.lower_bound(arg_idx)); }
+    template <typename I = Index>
+    key_const_iterator<I> lower_bound(const Idx& arg_idx) const
+    { stats_.onLookup(); return key_const_iterator<I>(map_.lower_bound(arg_idx)); }
+
+    /** The first element whose Idx is greater than arg_idx. O(log n). */
+    template <typename I = Index>
+    key_iterator<I> upper_bound(const Idx& arg_idx)
+    { stats_.onLookup(); return key_iterator<I>(map_.upper_bound(arg_idx)); }
+    template <typename I = Index>
+    key_const_iterator<I> upper_bound(const Idx& arg_idx) const
+    { stats_.onLookup(); return key_const_iterator<I>(map_.upper_bound(arg_idx)); }
+
+    /** The elements with Idx == arg_idx (none or one). O(log n). */
+    template <typename I = Index>
+    std::pair<key_iterator<I>, key_iterator<I> > equal_range(const Idx& arg_idx)
+    { return std::make_pair(lower_bound<I>(arg_idx), upper_bound<I>(arg_idx)); }
+    template <typename I = Index>
+    std::pair<key_const_iterator<I>, key_const_iterator<I> > equal_range(const Idx& arg_idx) const
+    { return std::make_pair(lower_bound<I>(arg_idx), upper_bound<I>(arg_idx)); }
+
+    /** The elements whose Idx starts with arg_prefix, in key order. For
+     * string keys. O(log n) to find the range (no list walk).
+     *
+     * Usage:
+     *   auto r = links.prefix_range("arm_");
+     *   for(; r.first != r.second; ++r.first) { r.first->compute(); } */
+    template <typename I = Index>
+    std::pair<key_iterator<I>, key_iterator<I> > prefix_range(const Idx& arg_prefix)
+    {
+      Idx succ;
+      bool has_succ = prefixSuccessor(arg_prefix, succ);
+      return std::make_pair(lower_bound<I>(arg_prefix),
+          has_succ ? lower_bound<I>(succ) : key_end<I>());
+    }
+    template <typename I = Index>
+    std::pair<key_const_iterator<I>, key_const_iterator<I> > prefix_range(const Idx& arg_prefix) const
+    {
+      Idx succ;
+      bool has_succ = prefixSuccessor(arg_prefix, succ);
+      return std::make_pair(lower_bound<I>(arg_prefix),
+          has_succ ? lower_bound<I>(succ) : key_end<I>());
+    }
+
+    /** Updates the index after an element's fields changed, for indices
+     * that read them (see CMappedListIndexSecondary::reindex). Finds
+     * the element as erase(const T*) does. Returns false if it isn't in the list, or if
+     * the index refused its new key (and kept the old one). */
+    bool reindex(const T* arg_t)
+    {
+      SMLNode<Idx,T>* t = nodeOf(arg_t);
+      if(NULL == t) { return false; }
+      return map_.reindex(t);
+    }
+
     /** Returns the size of the mapped list */
     virtual std::size_t size() const
     { return size_; }
@@ -230,10 +954,156 @@ namespace sutil
     /** Clears all elements from the list */
     virtual bool clear();
 
+    /** Prepares for arg_n elements : Creating up to arg_n elements (and
+     * positional lookups on them) won't grow the allocator, the index,
+     * the pointer table or the position cache. */
+    void reserve(const std::size_t arg_n);
+
     /** Typical operator access */
     virtual T* operator[](const std::size_t arg_idx)
     { return at(arg_idx); }
 
+    /** The node allocator (eg. to query a pool's memory use) */
+    const Alloc& getAlloc() const
+    { return alloc_; }
+
+    /** The Idx index (eg. to query a hash table's load) */
+    const Index& getIndex() const
+    { return map_; }
+
+    /** The stats policy (eg. to read or reset the counters) */
+    const Stats& getStats() const
+    { return stats_; }
+
+    Stats& getStats()
+    { return stats_; }
+
+    /** A counter that changes whenever nodes are added, removed or
+     * reordered. Snapshots (eg. CMappedListFrozen) compare it to tell
+     * if they are stale. Changes to the elements themselves (through
+     * the returned pointers) are not counted. */
+    std::size_t getVersion() const
+    { return version_; }
+
+    /** Fills ret_ptrs with the elements' pointers, in list order.
+     * Copies the position cache if it is valid, else walks the list
+     * (without building the cache). O(n).
+     *
+     * Used to split the list into chunks (eg. for parallel_for_each). */
+    void getElementPointers(std::vector<T*>& ret_ptrs);
+
+    /** Const version of the above */
+    void getElementPointers(std::vector<const T*>& ret_ptrs) const;
+
+  protected:
+    /** Checks for a duplicate index, then allocates a node (constructing
+     * the element from arg_args), links it and indexes it. */
+    template <typename I, typename... Args>
+    T* emplaceAt(const bool insert_at_start, I&& arg_idx, Args&&... arg_args);
+
+    /** Implements createRange. If ret_created isn't NULL, the created
+     * elements are appended to it (in the range's order). */
+    template <typename ForwardIt>
+    bool createRangeImpl(ForwardIt arg_first, ForwardIt arg_last,
+        std::vector<T*>* ret_created);
+
+    /** Orders (key, position) pairs by key */
+    struct SRangeKeyLess
+    {
+      bool operator()(const std::pair<const Idx*,std::size_t>& arg_a,
+          const std::pair<const Idx*,std::size_t>& arg_b) const
+      { return *(arg_a.first) < *(arg_b.first); }
+    };
+
+    /** The smallest string greater than every string that starts with
+     * arg_prefix (arg_prefix with its last char incremented, after
+     * dropping trailing 0xff chars). Returns false if there is none (all
+     * strings from the prefix on match, eg. for ""). Strings compare
+     * chars as unsigned, so this does too. */
+    static bool prefixSuccessor(const Idx& arg_prefix, Idx& ret_succ)
+    {
+      ret_succ = arg_prefix;
+      while(0 < ret_succ.size() &&
+          0xff == static_cast<unsigned char>(ret_succ[ret_succ.size()-1]))
+      { ret_succ.erase(ret_succ.size()-1); }
+      if(0 == ret_succ.size()) { return false; }
+      ret_succ[ret_succ.size()-1] = static_cast<typename Idx::value_type>(
+          static_cast<unsigned char>(ret_succ[ret_succ.size()-1]) + 1);
+      return true;
+    }
+
+    /** Marks the position cache (and any snapshots) as stale. Call this
+     * whenever nodes are added, removed or reordered. The cache is
+     * rebuilt (in O(n)) by the next positional query. */
+    void invalidatePositions()
+    { flag_pos_valid_ = false; version_++; }
+
+    /** Rebuilds the position cache if it is stale */
+    void updatePositions();
+
+    /** The node at a position (which must be less than the size). Reads
+     * the cache (or the rank policy) if it is valid, else walks the list.
+     * Never writes, so const readers may share the list. */
+    const SMLNode<Idx,T>* nodeAtConst(const std::size_t arg_idx) const;
+
+    /** The node that holds arg_t (NULL if it isn't in the list). Asks
+     * the node table if it keeps one, else the position cache if it is
+     * valid, else walks the list. */
+    SMLNode<Idx,T>* nodeOf(const T* arg_t) const;
+
+    /** The bytes a node holds (the node, its Idx and its T) for the
+     * stats policy. Excludes memory that T itself allocates. */
+    static std::size_t nodeBytes()
+    { return sizeof(SMLNode<Idx,T>) + sizeof(Idx) + sizeof(T); }
+
+    /** Links a freshly allocated node into the list (at the front
+     * by default, else at the back). Does not touch the map. */
+    void linkNode(SMLNode<Idx,T>* arg_node, const bool insert_at_start);
+
+    /** Unlinks a node from the list. Does not touch the map and
+     * does not deallocate the node. */
+    void unlinkNode(SMLNode<Idx,T>* arg_node);
+
+    /** Replaces the contents with copies of the passed list's nodes
+     * (in the same order). All the nodes are reserved up front, and the
+     * index is copied from the passed list's index (see the index
+     * policy's cloneFrom) instead of re-inserting each key.
+     *
+     * ret_remap maps each of the passed list's data pointers to the
+     * matching new node, so that subclasses can translate their own
+     * pointers (eg. a tree's parent and child links) without name
+     * lookups. */
+    bool cloneNodes(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_src,
+        CMappedListPtrTable<SMLNode<Idx,T>*>& ret_remap);
+
+    /** Translates a data pointer from the list that was passed to
+     * cloneNodes into the matching data pointer in this list. NULL if
+     * the pointer wasn't in the cloned list. */
+    static T* cloneRemap(const CMappedListPtrTable<SMLNode<Idx,T>*>& arg_remap,
+        const T* arg_old)
+    {
+      SMLNode<Idx,T>* node = NULL;
+      if(false == arg_remap.find(static_cast<const void*>(arg_old), node))
+      { return NULL; }
+      return node->data_;
+    }
+
+    /** Maps a cloned list's nodes to this list's (for Index::cloneFrom) */
+    struct SCloneNodeRemap
+    {
+      const CMappedListPtrTable<SMLNode<Idx,T>*>* remap_;
+      explicit SCloneNodeRemap(const CMappedListPtrTable<SMLNode<Idx,T>*>* arg_remap) :
+          remap_(arg_remap) {}
+      SMLNode<Idx,T>* operator()(const SMLNode<Idx,T>* arg_node) const
+      {
+        SMLNode<Idx,T>* node = NULL;
+        if(NULL == arg_node ||
+            false == remap_->find(static_cast<const void*>(arg_node->data_), node))
+        { return NULL; }
+        return node;
+      }
+    };
+
     /** *******************************************************
      *                      Mapped List Data
      * ******************************************************* */
@@ -249,33 +1119,51 @@ namespace sutil
      * Does not exist in the map. */
     SMLNode<Idx,T> null_;
 
-    /** The map that will enable Idx based data lookup */
-    std::map<Idx, SMLNode<Idx,T>*> map_;
+    /** The index (a std::map by default) that enables Idx based data lookup */
+    Index map_;
 
     /** The size of the MappedList */
     std::size_t size_;
 
+    /** Allocates (and deallocates) the nodes */
+    Alloc alloc_;
+
+    /** Finds each element's node from its address (if the policy keeps
+     * a table). Kept up to date by linkNode/unlinkNode. */
+    NodeTable node_table_;
+
   public:
-    /** An stl style iterator for CMappedList */
-    class iterator : public std::iterator<std::forward_iterator_tag, T>
+    /** An stl style iterator for CMappedList.
+     *
+     * Jumps (it + n, it - n, it2 - it etc.) step one node at a time,
+     * unless the list's rank policy is indexed, in which case they are
+     * O(log n) and the iterator is random access. */
+    class iterator : public std::iterator<typename std::conditional<Rank::Indexed,
+        std::random_access_iterator_tag, std::forward_iterator_tag>::type, T>
     {
       //To allow : const_iterator x = iterator();
       friend class const_iterator;
 
       SMLNode<Idx,T> *pos_;
+      /** The list, for O(log n) jumps (NULL if the iterator wasn't
+       * obtained from begin() or end()) */
+      const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable> *list_;
     public:
-      explicit iterator(): pos_(NULL){}
+      explicit iterator(): pos_(NULL), list_(NULL){}
 
       /** Explicit so that other iterators don't typecast into this one*/
       iterator(const iterator& other)
-      { pos_ = other.pos_; }
+      { pos_ = other.pos_; list_ = other.list_; }
 
       explicit iterator(SMLNode<Idx,T>* node_ptr)
-      { pos_ = node_ptr; }
+      { pos_ = node_ptr; list_ = NULL; }
+
+      iterator(SMLNode<Idx,T>* node_ptr, const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* arg_list)
+      { pos_ = node_ptr; list_ = arg_list; }
 
       iterator&
       operator = (const iterator& other)
-      { pos_ = other.pos_; return (*this);  }
+      { pos_ = other.pos_; list_ = other.list_; return (*this);  }
 
       bool
       operator == (const iterator& other)
@@ -317,18 +1205,14 @@ namespace sutil
         return *this;
       }
 
+      /** Stops at end() */
       iterator
       operator +(int offset)
-      {
-        SMLNode<Idx,T> *ptr = this->pos_;
-        for(int i=0; i <offset; ++i)
-        {
-          if(NULL== ptr->next_) { break; }
-          ptr = ptr->next_;
-        }
+      { return iterator(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, pos_, offset), list_); }
 
-        return iterator(ptr);
-      }
+      iterator&
+      operator +=(int offset)
+      { pos_ = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, pos_, offset); return *this; }
 
       /** Postfix x--. Note that its argument must be an int */
       iterator&
@@ -348,39 +1232,53 @@ namespace sutil
         return *this;
       }
 
+      /** Stops at begin() */
       iterator
       operator -(int offset)
-      {
-        SMLNode<Idx,T> *ptr = this->pos_;
-        for(int i=0; i < offset; ++i)
-        {
-          if(NULL== ptr->prev_) { break; }
-          ptr = ptr->prev_;
-        }
+      { return iterator(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, pos_, -offset), list_); }
 
-        return iterator(ptr);
-      }
+      iterator&
+      operator -=(int offset)
+      { pos_ = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, pos_, -offset); return *this; }
+
+      /** The number of steps from other to this iterator */
+      std::ptrdiff_t
+      operator -(const iterator& other) const
+      { return CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::distanceNodes(list_, other.pos_, pos_); }
+
+      bool
+      operator < (const iterator& other) const
+      { return 0 < (other - *this); }
+
+      T&
+      operator [](int offset)
+      { return *(*this + offset); }
     };
 
-    /** An stl style const_iterator for CMappedList */
-    class const_iterator : public std::iterator<std::forward_iterator_tag, T>
+    /** An stl style const_iterator for CMappedList (see iterator) */
+    class const_iterator : public std::iterator<typename std::conditional<Rank::Indexed,
+        std::random_access_iterator_tag, std::forward_iterator_tag>::type, T>
     {
       const SMLNode<Idx,T> *pos_;
+      const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable> *list_;
     public:
-      explicit const_iterator(): pos_(NULL){}
+      explicit const_iterator(): pos_(NULL), list_(NULL){}
 
       /** Explicit so that other const_iterators don't typecast into this one*/
       const_iterator(const const_iterator& other)
-      { pos_ = other.pos_; }
+      { pos_ = other.pos_; list_ = other.list_; }
 
       explicit const_iterator(const SMLNode<Idx,T>* node_ptr)
-      { pos_ = node_ptr; }
+      { pos_ = node_ptr; list_ = NULL; }
+
+      const_iterator(const SMLNode<Idx,T>* node_ptr, const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* arg_list)
+      { pos_ = node_ptr; list_ = arg_list; }
 
       const const_iterator& operator = (const const_iterator& other)
-      { pos_ = other.pos_; return (*this);  }
+      { pos_ = other.pos_; list_ = other.list_; return (*this);  }
 
       const const_iterator& operator = (const iterator& other)
-      { pos_ = static_cast<const SMLNode<Idx,T> *>(other.pos_); return (*this);  }
+      { pos_ = static_cast<const SMLNode<Idx,T> *>(other.pos_); list_ = other.list_; return (*this);  }
 
       bool
       operator == (const const_iterator& other)
@@ -422,18 +1320,14 @@ namespace sutil
         return *this;
       }
 
+      /** Stops at end() */
       const_iterator
       operator +(int offset)
-      {
-        const SMLNode<Idx,T> *ptr = this->pos_;
-        for(int i=0; i <offset; ++i)
-        {
-          if(NULL== ptr->next_) { break; }
-          ptr = ptr->next_;
-        }
+      { return const_iterator(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, const_cast<SMLNode<Idx,T>*>(pos_), offset), list_); }
 
-        return const_iterator(ptr);
-      }
+      const_iterator&
+      operator +=(int offset)
+      { pos_ = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, const_cast<SMLNode<Idx,T>*>(pos_), offset); return *this; }
 
       /** Postfix x--. Note that its argument must be an int */
       const_iterator&
@@ -453,40 +1347,102 @@ namespace sutil
         return *this;
       }
 
+      /** Stops at begin() */
       const_iterator
       operator -(int offset)
-      {
-        const SMLNode<Idx,T> *ptr = this->pos_;
-        for(int i=0; i <offset; --i)
-        {
-          if(NULL== ptr) { break; }
-          ptr = ptr->prev_;
-        }
+      { return const_iterator(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, const_cast<SMLNode<Idx,T>*>(pos_), -offset), list_); }
 
-        return const_iterator(ptr);
-      }
-    };
+      const_iterator&
+      operator -=(int offset)
+      { pos_ = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::advanceNode(list_, const_cast<SMLNode<Idx,T>*>(pos_), -offset); return *this; }
 
-    /** ***************************
+      /** The number of steps from other to this iterator */
+      std::ptrdiff_t
+      operator -(const const_iterator& other) const
+      { return CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::distanceNodes(list_, other.pos_, pos_); }
+
+      bool
+      operator < (const const_iterator& other) const
+      { return 0 < (other - *this); }
+
+      const T&
+      operator [](int offset)
+      { return *(*this + offset); }
+    };
+
+    /** ***************************
      * The iterator functions
      * ************************** */
     iterator begin()
     {
-      if(NULL!=front_){ return iterator(front_);  }
-      else{ return iterator(&null_);  }
+      if(NULL!=front_){ return iterator(front_, this);  }
+      else{ return iterator(&null_, this);  }
     }
 
     const_iterator begin() const
     {
-      if(NULL!=front_){ return const_iterator(front_);  }
-      else{ return const_iterator(&null_);  }
+      if(NULL!=front_){ return const_iterator(front_, this);  }
+      else{ return const_iterator(&null_, this);  }
     }
 
     iterator end()
-    { return iterator(&null_); }
+    { return iterator(&null_, this); }
 
     const_iterator end() const
-    { return const_iterator(&null_); }
+    { return const_iterator(&null_, this); }
+
+  protected:
+    /** A node's position (size_ for the end() sentinel). Needs an
+     * indexed rank policy. O(log n). */
+    std::size_t positionOfNode(const SMLNode<Idx,T>* arg_node) const
+    {
+      std::size_t pos;
+      if(&null_ == arg_node || false == rank_.positionOf(arg_node, pos))
+      { return size_; }
+      return pos;
+    }
+
+    /** Moves arg_offset nodes forward (back if negative) from arg_node,
+     * stopping at the front or at the end() sentinel. O(log n) through
+     * the rank policy if it is indexed (and the list is known), else
+     * O(offset). */
+    static SMLNode<Idx,T>* advanceNode(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* arg_list,
+        SMLNode<Idx,T>* arg_node, long arg_offset)
+    {
+      if(NULL == arg_node) { return NULL; }
+      if(Rank::Indexed && NULL != arg_list)
+      {
+        long pos = static_cast<long>(arg_list->positionOfNode(arg_node)) + arg_offset;
+        if(0 > pos) { pos = 0; }
+        if(static_cast<long>(arg_list->size_) <= pos)
+        { return const_cast<SMLNode<Idx,T>*>(&(arg_list->null_)); }
+        return arg_list->rank_.nodeAt(static_cast<std::size_t>(pos));
+      }
+      for(; 0 < arg_offset && NULL != arg_node->next_; --arg_offset)
+      { arg_node = arg_node->next_; }
+      for(; 0 > arg_offset && NULL != arg_node->prev_; ++arg_offset)
+      { arg_node = arg_node->prev_; }
+      return arg_node;
+    }
+
+    /** The number of steps from arg_from to arg_to. O(log n) through an
+     * indexed rank policy, else walks the list. */
+    static std::ptrdiff_t distanceNodes(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* arg_list,
+        const SMLNode<Idx,T>* arg_from, const SMLNode<Idx,T>* arg_to)
+    {
+      if(Rank::Indexed && NULL != arg_list)
+      {
+        return static_cast<std::ptrdiff_t>(arg_list->positionOfNode(arg_to)) -
+            static_cast<std::ptrdiff_t>(arg_list->positionOfNode(arg_from));
+      }
+      std::ptrdiff_t n = 0;
+      for(const SMLNode<Idx,T>* t = arg_from; NULL != t; t = t->next_, ++n)
+      { if(arg_to == t) { return n; } }
+      n = 0;
+      for(const SMLNode<Idx,T>* t = arg_from; NULL != t; t = t->prev_, --n)
+      { if(arg_to == t) { return n; } }
+      return 0;
+    }
 
     /** *******************************************************
      *                 Sorting related functions
@@ -500,10 +1456,32 @@ namespace sutil
      * Any create/erase/swap etc. function call will invalidate
      * the sort ordering.
      *
-     * Sorting type : Insertion Sort.
+     * Sorting type : O(n). One index lookup per element, then the
+     * nodes are relinked (see applyPermutation).
      */
     virtual bool sort(const std::vector<Idx> &arg_order);
 
+    /** Sorts the list so that iterator access is in ascending order
+     * by the passed comparator : bool arg_comp(const T&, const T&).
+     * The sort order (of indices) is then available from
+     * sort_get_order().
+     *
+     * Sorting type : Merge sort on the node links. O(n log n), stable,
+     * doesn't allocate and doesn't touch the index. */
+    template <typename Compare>
+    bool sort(Compare arg_comp);
+
+    /** Reorders the list so that the element at position arg_perm[i]
+     * moves to position i. Eg. {2,0,1} on (a,b,c) gives (c,a,b).
+     *
+     * Use this to put the nodes in the order they are traversed (eg. a
+     * tree's depth first order). O(n). Only relinks the nodes; the
+     * index isn't touched and the element pointers stay valid.
+     *
+     * Returns false (and changes nothing) if arg_perm isn't a
+     * permutation of 0 to size()-1. */
+    virtual bool applyPermutation(const std::vector<std::size_t>& arg_perm);
+
     /** Get the sorting order if there is one */
     virtual bool sort_get_order(std::vector<Idx>& ret_order) const
     {
@@ -518,11 +1496,44 @@ namespace sutil
     { return flag_is_sorted_;  }
 
   protected:
+    /** Relinks the list in the passed order (which must contain each
+     * node exactly once), and records it as the sort order. */
+    void relinkInOrder(const std::vector<SMLNode<Idx,T>*>& arg_nodes);
+
+    /** Erasing keeps the survivors' order. Marks the list sorted again
+     * (if it was) with the survivors' Idx as the sort order. O(n). */
+    void keepSortedAfterErase(const bool arg_was_sorted);
+
     /** An index that specifies a sort ordering if required */
     std::vector<Idx> sorting_order_;
 
     /** Whether the list is sorted or not */
     bool flag_is_sorted_;
+
+    /** *******************************************************
+     *                   Position cache
+     * ******************************************************* */
+    /** The nodes in list order (valid if flag_pos_valid_) */
+    std::vector<SMLNode<Idx,T>*> pos_nodes_;
+
+    /** Maps each node's data pointer to its position (valid if flag_pos_valid_) */
+    CMappedListPtrTable<std::size_t> pos_table_;
+
+    /** Whether the position cache matches the list. Only the non-const
+     * functions rebuild it (the const ones walk the list if it is
+     * stale), so const readers never write to the list. */
+    bool flag_pos_valid_;
+
+    /** Counts the list's work (see the stats policy). Moves with the
+     * nodes on swap(). */
+    Stats stats_;
+
+    /** Finds positions in O(log n) while the list changes (if the rank
+     * policy keeps anything). Updated by linkNode/unlinkNode. */
+    Rank rank_;
+
+    /** Incremented on every structural change (see getVersion) */
+    std::size_t version_;
   }; //End of class.
 
   /** This is to delete the second pointers in the destructor. Useful
@@ -555,8 +1566,52 @@ namespace sutil
     }
   };
 
-  template <typename Idx, typename T>
-  bool CMappedList<Idx,T>::deepCopy(const CMappedList<Idx,T>* const arg_pmap)
+  /** A CMappedList that can't be derived from. Use it (instead of a
+   * CMappedList) when the container's type is known, eg. a member in a
+   * controller.
+   *
+   * Every CMappedList method is virtual, so a call through a CMappedList&
+   * (or pointer) goes through the vtable and can't be inlined. Calls on a
+   * final class have only one possible target, so the compiler calls
+   * (and inlines) size(), at(), operator[] etc. directly. The behaviour
+   * is the same as a CMappedList's.
+   *
+   * Usage:
+   *   sutil::CMappedListFinal<std::string,SJoint> joints;
+   *   for(std::size_t i=0; i<joints.size(); ++i) { joints[i]->q_ += dq; }
+   *
+   * NOTE : Pass it around as a CMappedListFinal& to keep the fast calls.
+   *        It still converts to a CMappedList& (with virtual calls). */
+  template <typename Idx, typename T, typename Alloc = CMappedListAllocNew<Idx,T>,
+            typename Index = CMappedListIndexMap<Idx,T>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<Idx,T>,
+            typename NodeTable = CMappedListNodeTableNone<Idx,T> >
+  class CMappedListFinal final : public CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>
+  {
+    typedef CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable> base;
+  public:
+    CMappedListFinal() : base() {}
+
+    /** Copy Constructor : Performs a deep-copy (see CMappedList) */
+    explicit CMappedListFinal(const CMappedListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_pm) :
+        base(arg_pm) {}
+
+    /** Move Constructor : Takes over the passed list's nodes in O(1) */
+    CMappedListFinal(CMappedListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_pm) noexcept :
+        base(std::move(arg_pm)) {}
+
+    CMappedListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (const CMappedListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_rhs)
+    { base::operator = (arg_rhs); return *this; }
+
+    CMappedListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
+    { base::operator = (std::move(arg_rhs)); return *this; }
+
+    virtual ~CMappedListFinal() {}
+  };
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::deepCopy(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* const arg_pmap)
   {//Deep copy.
     //No need if both are identical
     if(this == arg_pmap)
@@ -573,26 +1628,69 @@ namespace sutil
     }
     else
     {
-      CMappedList<Idx,T>::const_iterator it,ite;
-      for(it = arg_pmap->begin(), ite = arg_pmap->end(); it!=ite; ++it)
+      CMappedListPtrTable<SMLNode<Idx,T>*> remap;
+      if(false == cloneNodes(*arg_pmap, remap))
       {
-        T* tmp = CMappedList<Idx,T>::create(!it,*it,false);
-        if(NULL == tmp)
-        {
 #ifdef DEBUG
-          std::cerr<<"\nCMappedList<Idx,T>::CMappedList(const CMappedList<Idx,T>& arg_pmap) : ";
-          std::cerr<<"ERROR : Deep copy failed to duplicate a node. Resetting mappedlist.";
+        std::cerr<<"\nCMappedList<Idx,T,Alloc,Index>::CMappedList(const CMappedList<Idx,T,Alloc,Index>& arg_pmap) : ";
+        std::cerr<<"ERROR : Deep copy failed to duplicate a node. Resetting mappedlist.";
 #endif
-          clear();//Reset the mappedlist.
-          return false;
-        }
+        return false;
       }
     }
     return true;
   }
 
-  template <typename Idx, typename T>
-  CMappedList<Idx,T>::~CMappedList()
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::cloneNodes(
+      const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_src,
+      CMappedListPtrTable<SMLNode<Idx,T>*>& ret_remap)
+  {
+    if(this == &arg_src) { return false; }
+    clear();
+    ret_remap.clear();
+    if(0 == arg_src.size_) { return true; }
+
+    alloc_.reserve(arg_src.size_);
+    node_table_.reserve(arg_src.size_);
+    ret_remap.reserve(arg_src.size_);
+
+    //Copy the nodes in order (no index lookups; the keys are unique)
+    const SMLNode<Idx,T>* t = arg_src.front_;
+    for(std::size_t i=0; i<arg_src.size_; ++i, t = t->next_)
+    {
+      SMLNode<Idx,T>* node = alloc_.createNode(*(t->id_), *(t->data_));
+      if(NULL == node)
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedList<Idx,T,Alloc,Index>::cloneNodes() : ERROR : Could not allocate a node.";
+#endif
+        clear(); ret_remap.clear();
+        return false;
+      }
+      linkNode(node, false);
+      ret_remap.insert(static_cast<const void*>(t->data_), node);
+      stats_.onAlloc(nodeBytes()); stats_.onCreate();
+    }
+
+    //Copy the index's structure, pointing it at the new nodes
+    if(false == map_.cloneFrom(arg_src.map_, SCloneNodeRemap(&ret_remap)))
+    {
+#ifdef DEBUG
+      std::cerr<<"\nCMappedList<Idx,T,Alloc,Index>::cloneNodes() : ERROR : Could not copy the index.";
+#endif
+      clear(); ret_remap.clear();
+      return false;
+    }
+
+    //Same order, so the same sorting state
+    flag_is_sorted_ = arg_src.flag_is_sorted_;
+    sorting_order_ = arg_src.sorting_order_;
+    return true;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::~CMappedList()
   {
     SMLNode<Idx,T> *t;
 
@@ -606,12 +1704,7 @@ namespace sutil
     t = front_->next_;
     while(NULL!=t)
     {
-      if(NULL!=t->prev_->data_)
-      { delete t->prev_->data_;  }
-      if(NULL!=t->prev_->id_)
-      { delete t->prev_->id_;  }
-      delete t->prev_;
-
+      alloc_.destroyNode(t->prev_);
       t = t->next_;
     }
 
@@ -619,12 +1712,13 @@ namespace sutil
     map_.clear();
     size_ = 0;
     flag_is_sorted_ = false;
+    invalidatePositions();
   }
 
-  template <typename Idx, typename T>
-  bool CMappedList<Idx,T>::operator == (const CMappedList<Idx,T>& rhs)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::operator == (const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& rhs)
   {
-    CMappedList<Idx,T>::const_iterator it, ite, it2, it2e;
+    CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::const_iterator it, ite, it2, it2e;
     for(it = begin(), ite = end(),
         it2 = rhs.begin(), it2e = rhs.end();
         it!=ite && it2!=it2e; ++it, ++it2)
@@ -641,137 +1735,121 @@ namespace sutil
     { return false; }
   }
 
-  template <typename Idx, typename T>
-  bool CMappedList<Idx,T>::operator != (const CMappedList<Idx,T>& rhs)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::operator != (const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& rhs)
   { return !(*this == rhs);}
 
 
-  template <typename Idx, typename T>
-  void CMappedList<Idx,T>::swap(CMappedList<Idx,T>& arg_swap_obj)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::swap(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_swap_obj) noexcept
   {
-    //Be lazy
-    CMappedList<Idx,T> *lhs, *rhs;
-    if(size_ >= arg_swap_obj.size_)
-    { lhs = this; rhs = &arg_swap_obj;  }
-    else
-    { lhs = &arg_swap_obj; rhs = this;  }
+    if(this == &arg_swap_obj) { return; }
 
     //List status.
-    SMLNode<Idx,T> *tf = lhs->front_;
-    SMLNode<Idx,T> *tb = lhs->back_;
-    std::map<Idx, SMLNode<Idx,T>*> tmap(lhs->map_);
-    size_t ts = lhs->size_;
+    std::swap(front_, arg_swap_obj.front_);
+    std::swap(back_, arg_swap_obj.back_);
+    std::swap(size_, arg_swap_obj.size_);
+
+    //The end() sentinels stay with their lists. Re-point the back nodes.
+    null_.prev_ = back_;
+    if(0 < size_) {  back_->next_ = &null_;  }
+    arg_swap_obj.null_.prev_ = arg_swap_obj.back_;
+    if(0 < arg_swap_obj.size_) {  arg_swap_obj.back_->next_ = &(arg_swap_obj.null_);  }
 
     //Sorting status
-    bool tmp_lhs_sorted = lhs->flag_is_sorted_;
-    std::vector<Idx> tmp_lhs_sorting_order;
-    if(lhs->flag_is_sorted_)
-    { tmp_lhs_sorting_order = lhs->sorting_order_;  }
-
-    //Copy list status
-    lhs->front_ = rhs->front_;
-    lhs->back_ = rhs->back_;
-    lhs->map_ = rhs->map_;
-    lhs->size_ = rhs->size_;
-    lhs->null_.prev_ = lhs->back_;
-    if(0 < lhs->size_) {  lhs->back_->next_ = &(lhs->null_);  }
-
-    //Copy sorting status
-    lhs->flag_is_sorted_ = rhs->flag_is_sorted_;
-    if(lhs->flag_is_sorted_)
-    { lhs->sorting_order_ = rhs->sorting_order_;  }
-    else { lhs->sorting_order_.clear();  }
-
-    //Copy list status from tmp
-    rhs->front_ = tf;
-    rhs->back_ = tb;
-    rhs->map_ = tmap;
-    rhs->size_ = ts;
-    rhs->null_.prev_ = rhs->back_;
-    if(0 < rhs->size_) {  rhs->back_->next_ = &(rhs->null_);  }
-
-    //Copy sorting status from tmp
-    rhs->flag_is_sorted_ = tmp_lhs_sorted;
-    if(rhs->flag_is_sorted_)
-    { rhs->sorting_order_ = tmp_lhs_sorting_order;  }
-    else { rhs->sorting_order_.clear();  }
+    std::swap(flag_is_sorted_, arg_swap_obj.flag_is_sorted_);
+    sorting_order_.swap(arg_swap_obj.sorting_order_);
+
+    //The nodes now belong to the other list's allocator and index.
+    //The position caches only hold node pointers, so they move too.
+    alloc_.swap(arg_swap_obj.alloc_);
+    map_.swap(arg_swap_obj.map_);
+    node_table_.swap(arg_swap_obj.node_table_);
+    pos_nodes_.swap(arg_swap_obj.pos_nodes_);
+    pos_table_.swap(arg_swap_obj.pos_table_);
+    std::swap(flag_pos_valid_, arg_swap_obj.flag_pos_valid_);
+    std::swap(stats_, arg_swap_obj.stats_);
+    rank_.swap(arg_swap_obj.rank_);
+
+    //Both lists changed (the versions stay with the objects)
+    version_++; arg_swap_obj.version_++;
   }
 
-  template <typename Idx, typename T>
-  T* CMappedList<Idx,T>::create(const Idx & arg_idx, const bool insert_at_start)
-  { return CMappedList<Idx,T>::create(arg_idx,T(),insert_at_start); }
-
-  template <typename Idx, typename T>
-  T* CMappedList<Idx,T>::create(const Idx & arg_idx, const T& arg_t, const bool insert_at_start)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::linkNode(SMLNode<Idx,T>* arg_node, const bool insert_at_start)
   {
-    SMLNode<Idx,T> * tmp = new SMLNode<Idx,T>();
-
-    if(NULL==tmp) //Memory not allocated
-    { return NULL; }
-
-    //Make sure the idx hasn't already been registered.
-    if(map_.find(arg_idx) != map_.end())
-    {
-#ifdef DEBUG
-      std::cerr<<"\nCMappedList<Idx,T>::create() ERROR : Idx exists. Tried to add duplicate entry";
-#endif
-      return NULL;
-    }
-
-    tmp->data_ = new T(arg_t);
-    tmp->id_ = new Idx(arg_idx);
-
     /** If size is zero, insert at start/end doesn't matter. */
     if(0 == size_)
     {
-      back_ = tmp;
-      front_ = tmp;
+      back_ = arg_node;
+      front_ = arg_node;
       front_->prev_ = NULL;
-      front_->next_ = &null_;
+      front_->next_ = &null_;//Set the end "null" terminator node..
       null_.prev_ = back_;
-      tmp = NULL;
     }
     else if(insert_at_start)
     {
-      tmp->next_ = front_;
-      front_->prev_ = tmp;
-      front_ = tmp;
+      arg_node->next_ = front_;
+      front_->prev_ = arg_node;
+      front_ = arg_node;
       front_->prev_ = NULL;
-      tmp = NULL;
     }
     else
     {
-      back_->next_ = tmp;
-      tmp->next_ = &null_;
-      tmp->prev_ = back_;
-      back_ = tmp;
+      back_->next_ = arg_node;
+      arg_node->prev_ = back_;
+      back_ = arg_node;
       null_.prev_ = back_;
-      back_->next_ = &null_;
-      tmp = NULL;
+      back_->next_ = &null_;//Set the end "null" terminator node..
     }
 
+    node_table_.onLink(arg_node);
+
     size_++;
+    rank_.onLink(arg_node, insert_at_start, front_, size_);
     flag_is_sorted_ = false;
-
-    if((0 == size_) || insert_at_start) {
-      map_.insert( std::pair<Idx, SMLNode<Idx,T> *>(arg_idx, front_) );
-      return front_->data_;
-    } else {
-      map_.insert( std::pair<Idx, SMLNode<Idx,T> *>(arg_idx, back_) );
-      return back_->data_;
-    }
+    invalidatePositions();
   }
 
-  template <typename Idx, typename T>
-  T* CMappedList<Idx,T>::insert(const Idx & arg_idx, T* arg_t, const bool insert_at_start)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::unlinkNode(SMLNode<Idx,T>* arg_node)
   {
-    SMLNode<Idx,T> * tmp = new SMLNode<Idx,T>();
+    if(1==size_)
+    { front_ = NULL; back_ = NULL; null_.prev_ = NULL;  }
+    else if(front_ == arg_node)
+    {
+      front_ = front_->next_;
+      front_->prev_ = NULL;
+    }
+    else if(back_ == arg_node)
+    {
+      back_ = back_->prev_;
+      back_->next_ = &null_;
+      null_.prev_ = back_;
+    }
+    else
+    {
+      arg_node->prev_->next_ = arg_node->next_;
+      arg_node->next_->prev_ = arg_node->prev_;
+    }
 
-    if(NULL==tmp) //Memory not allocated
-    { return NULL; }
+    node_table_.onUnlink(arg_node);
+
+    arg_node->next_ = NULL;
+    arg_node->prev_ = NULL;
+    size_--;
+    rank_.onUnlink(arg_node, front_, size_);
+    flag_is_sorted_ = false;
+    invalidatePositions();
+  }
 
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename I, typename... Args>
+  T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::emplaceAt(const bool insert_at_start,
+      I&& arg_idx, Args&&... arg_args)
+  {
     //Make sure the idx hasn't already been registered.
-    if(map_.find(arg_idx) != map_.end())
+    if(NULL != map_.find(arg_idx))
     {
 #ifdef DEBUG
       std::cerr<<"\nCMappedList<Idx,T>::create() ERROR : Idx exists. Tried to add duplicate entry";
@@ -779,194 +1857,327 @@ namespace sutil
       return NULL;
     }
 
-    tmp->data_ = arg_t;
-    tmp->id_ = new Idx(arg_idx);
+    SMLNode<Idx,T> * tmp = alloc_.createNode(std::forward<I>(arg_idx),
+        std::forward<Args>(arg_args)...);
 
-    /** If size is zero, insert at start/end doesn't matter. */
-    if(0 == size_)
+    if(NULL==tmp) //Memory not allocated
+    { return NULL; }
+
+    //arg_idx may have been moved into the node. The index may refuse
+    //the node (eg. a unique secondary index).
+    if(false == map_.insert(*(tmp->id_), tmp))
+    { alloc_.destroyNode(tmp); return NULL; }
+
+    linkNode(tmp, insert_at_start);
+    stats_.onAlloc(nodeBytes()); stats_.onCreate();
+    return tmp->data_;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename ForwardIt>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::createRangeImpl(ForwardIt arg_first,
+      ForwardIt arg_last, std::vector<T*>* ret_created)
+  {
+    //Sort the keys (with their positions in the range). Repeats
+    //are then adjacent.
+    std::vector<std::pair<const Idx*,std::size_t> > order;
+    std::size_t n = 0;
+    for(ForwardIt it = arg_first; it != arg_last; ++it, ++n)
     {
-      back_ = tmp;
-      front_ = tmp;
-      front_->prev_ = NULL;
-      front_->next_ = &null_;//Set the end "null" terminator node..
-      null_.prev_ = back_;
-      tmp = NULL;
+      const Idx& idx = (*it).first;
+      order.push_back(std::make_pair(&idx, n));
     }
-    else if(insert_at_start)
+    if(0 == n) { return true; }
+    std::sort(order.begin(), order.end(), SRangeKeyLess());
+
+    for(std::size_t i=0; i<n; ++i)
     {
-      tmp->next_ = front_;
-      front_->prev_ = tmp;
-      front_ = tmp;
-      front_->prev_ = NULL;
-      tmp = NULL;
+      if( (0 < i && false == (*(order[i-1].first) < *(order[i].first))) ||
+          (0 < size_ && NULL != map_.find(*(order[i].first))) )
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedList<Idx,T>::createRange() ERROR : Idx repeated or exists. Tried to add duplicate entry";
+#endif
+        return false;
+      }
     }
-    else
+
+    alloc_.reserve(n);
+    map_.reserve(size_ + n);
+
+    //Allocate every node before changing the list, so that a
+    //failure leaves the list as it was.
+    std::vector<SMLNode<Idx,T>*> nodes(n, static_cast<SMLNode<Idx,T>*>(NULL));
+    ForwardIt it = arg_first;
+    for(std::size_t i=0; i<n; ++i, ++it)
     {
-      back_->next_ = tmp;
-      tmp->next_ = &null_;//Set the end "null" terminator node..
-      tmp->prev_ = back_;
-      back_ = tmp;
-      null_.prev_ = back_;
-      back_->next_ = &null_;
-      tmp = NULL;
+      nodes[i] = alloc_.createNode((*it).first, (*it).second);
+      if(NULL == nodes[i])
+      {
+        for(std::size_t j=0; j<i; ++j) { alloc_.destroyNode(nodes[j]); }
+        return false;
+      }
     }
 
-    size_++;
-    flag_is_sorted_ = false;
+    //Build the index in sorted order (the keys may have been moved
+    //into the nodes, so read them from there). If the index refuses a
+    //node (eg. a unique secondary index), undo everything.
+    for(std::size_t i=0; i<n; ++i)
+    {
+      SMLNode<Idx,T>* node = nodes[order[i].second];
+      if(false == map_.insertHinted(*(node->id_), node))
+      {
+        for(std::size_t j=0; j<i; ++j)
+        { map_.erase(*(nodes[order[j].second]->id_)); }
+        for(std::size_t j=0; j<n; ++j) { alloc_.destroyNode(nodes[j]); }
+        return false;
+      }
+    }
 
-    if((0 == size_) || insert_at_start) {
-      map_.insert( std::pair<Idx, SMLNode<Idx,T> *>(arg_idx, front_) );
-      return front_->data_;
-    } else {
-      map_.insert( std::pair<Idx, SMLNode<Idx,T> *>(arg_idx, back_) );
-      return back_->data_;
+    for(std::size_t i=0; i<n; ++i)
+    {
+      linkNode(nodes[i], false);
+      stats_.onAlloc(nodeBytes()); stats_.onCreate();
     }
+
+    if(NULL != ret_created)
+    {
+      for(std::size_t i=0; i<n; ++i)
+      { ret_created->push_back(nodes[i]->data_); }
+    }
+    return true;
   }
 
-  template <typename Idx, typename T>
-  T* CMappedList<Idx,T>::at(const std::size_t arg_idx)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(const Idx & arg_idx, const bool insert_at_start)
+  { return emplaceAt(insert_at_start, arg_idx); }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(const Idx & arg_idx, const T& arg_t, const bool insert_at_start)
+  { return emplaceAt(insert_at_start, arg_idx, arg_t); }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::insert(const Idx & arg_idx, T* arg_t, const bool insert_at_start)
   {
-    if(NULL==front_)
-    { return NULL;  }
-    else
+    //Make sure the idx hasn't already been registered.
+    if(NULL != map_.find(arg_idx))
     {
-      if(arg_idx > size_)
-      { return NULL; }
-      SMLNode<Idx,T> * t = front_;
-
-      for(std::size_t i=0; i<arg_idx; ++i)
-      {
 #ifdef DEBUG
-        assert(i<=size_);
+      std::cerr<<"\nCMappedList<Idx,T>::create() ERROR : Idx exists. Tried to add duplicate entry";
 #endif
+      return NULL;
+    }
 
-        if(NULL==t)
-        { return NULL;  }
-        t = t->next_;
-      }
-      if(NULL==t)
-      { return NULL;  }
+    SMLNode<Idx,T> * tmp = alloc_.adoptNode(arg_idx, arg_t);
+
+    if(NULL==tmp) //Memory not allocated
+    { return NULL; }
 
-      return t->data_;
+    if(false == map_.insert(arg_idx, tmp))
+    {//The index refused it. Hand the element back to the caller.
+      tmp->data_ = NULL;
+      alloc_.destroyNode(tmp);
+      return NULL;
     }
+
+    linkNode(tmp, insert_at_start);
+    stats_.onAlloc(nodeBytes()); stats_.onCreate();
+    return tmp->data_;
   }
 
-  template <typename Idx, typename T>
-  T* CMappedList<Idx,T>::at(const Idx & arg_idx)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::updatePositions()
   {
-    if(NULL==front_)
-    { return NULL;  }
+    if(flag_pos_valid_) { return; }
+
+    pos_nodes_.resize(size_);
+    pos_table_.clear();
+    pos_table_.reserve(size_);
+
+    SMLNode<Idx,T> * t = front_;
+    for(std::size_t i=0; i<size_; ++i)
+    {
+#ifdef DEBUG
+      assert(NULL!=t && &null_!=t);
+#endif
+      pos_nodes_[i] = t;
+      pos_table_.insert(static_cast<const void*>(t->data_), i);
+      t = t->next_;
+    }
+    stats_.onWalk(size_);
+    flag_pos_valid_ = true;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  const SMLNode<Idx,T>* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::nodeAtConst(const std::size_t arg_idx) const
+  {
+    if(Rank::Indexed) { return rank_.nodeAt(arg_idx); }
+    if(flag_pos_valid_) { return pos_nodes_[arg_idx]; }
+    //Stale cache : Walk from the nearer end (without rebuilding it)
+    const SMLNode<Idx,T>* t;
+    if(arg_idx < size_/2)
+    {
+      t = front_;
+      for(std::size_t i=0; i<arg_idx; ++i) { t = t->next_; }
+      stats_.onWalk(arg_idx);
+    }
     else
     {
-      if(map_.find(arg_idx) == map_.end())
-      {
-        return NULL;
-      }
+      t = back_;
+      for(std::size_t i=size_-1; i>arg_idx; --i) { t = t->prev_; }
+      stats_.onWalk(size_-1-arg_idx);
+    }
+    return t;
+  }
 
-      SMLNode<Idx,T> * t = map_[arg_idx];
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  SMLNode<Idx,T>* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::nodeOf(const T* arg_t) const
+  {
+    if(NULL == arg_t || 0 == size_) { return NULL; }
+    SMLNode<Idx,T>* t;
+    if(NodeTable::Enabled)
+    { return node_table_.find(arg_t, t) ? t : NULL; }
 
-      if(NULL==t)
-      { return NULL;  }
-      else
-      { return t->data_;  }
+    std::size_t i;
+    if(flag_pos_valid_)
+    { return pos_table_.find(static_cast<const void*>(arg_t), i) ? pos_nodes_[i] : NULL; }
+
+    for(i = 0, t = front_; i<size_; ++i, t = t->next_)
+    {
+      if(t->data_ == arg_t)
+      { stats_.onWalk(i+1); return t; }
     }
+    stats_.onWalk(size_);
+    return NULL;
   }
 
-  template <typename Idx, typename T>
-  const Idx* CMappedList<Idx,T>::getIndexAt(const std::size_t arg_idx) const
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::at(const std::size_t arg_idx)
+  {
+    stats_.onPosLookup();
+    if(arg_idx >= size_)
+    { return NULL; }
+    if(Rank::Indexed) { return rank_.nodeAt(arg_idx)->data_; }
+    updatePositions();
+    return pos_nodes_[arg_idx]->data_;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::at(const Idx & arg_idx)
   {
+    stats_.onLookup();
     if(NULL==front_)
     { return NULL;  }
     else
     {
-      if(arg_idx > size_)
-      { return NULL; }
-      SMLNode<Idx,T> * t = front_;
-
-      for(std::size_t i=0; i<arg_idx; ++i)
-      {
-#ifdef DEBUG
-        assert(i<=size_);
-#endif
+      SMLNode<Idx,T> * t = map_.find(arg_idx);
 
-        if(NULL==t)
-        { return NULL;  }
-        t = t->next_;
-      }
       if(NULL==t)
       { return NULL;  }
-
-      return t->id_;
+      else
+      { return t->data_;  }
     }
   }
 
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  const Idx* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::getIndexAt(const std::size_t arg_idx) const
+  {
+    stats_.onPosLookup();
+    if(arg_idx >= size_)
+    { return NULL; }
+    return nodeAtConst(arg_idx)->id_;
+  }
+
   /** Returns the numeric index at the given typed index in the linked list */
-  template <typename Idx, typename T>
-  int CMappedList<Idx,T>::getIndexNumericAt(const Idx& arg_idx) const
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  int CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::getIndexNumericAt(const Idx& arg_idx) const
   {
     const T *tdes = at_const(arg_idx);
     return getIndexNumericAt(tdes);
   }
 
   /** Returns the numeric index at the given typed index in the linked list*/
-  template <typename Idx, typename T>
-  int CMappedList<Idx,T>::getIndexNumericAt(const T* const arg_node) const
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  int CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::getIndexNumericAt(const T* const arg_node) const
   {
-    if(NULL == arg_node) { return -1; }
+    stats_.onPosLookup();
+    if(NULL == arg_node || 0 == size_) { return -1; }
+    if(Rank::Indexed)
+    {
+      SMLNode<Idx,T>* node; std::size_t pos;
+      if(NULL == (node = nodeOf(arg_node)) ||
+          false == rank_.positionOf(node, pos))
+      { return -1; }
+      return static_cast<int>(pos);
+    }
 
-    SMLNode<Idx,T> *t = front_;
+    std::size_t idx;
+    if(flag_pos_valid_)
+    {
+      if(false == pos_table_.find(static_cast<const void*>(arg_node), idx))
+      { return -1; }
+      return static_cast<int>(idx);
+    }
 
-    int idx = 0;
-    while(t->data_ != arg_node && NULL!=t)
-    { t = t->next_; idx++;  }
+    //Stale cache : Walk the list (without rebuilding it)
+    const SMLNode<Idx,T>* t = front_;
+    for(idx = 0; idx<size_; ++idx, t = t->next_)
+    { if(t->data_ == arg_node) { break; } }
+    stats_.onWalk(idx < size_ ? idx+1 : size_);
+    return (idx < size_) ? static_cast<int>(idx) : -1;
+  }
 
-    if(NULL == t){idx = -1;}
 
-    return idx;
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  const T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::at_const(const std::size_t arg_idx) const
+  {
+    stats_.onPosLookup();
+    if(arg_idx >= size_)
+    { return NULL; }
+    return (const T*) nodeAtConst(arg_idx)->data_;
   }
 
-
-  template <typename Idx, typename T>
-  const T* CMappedList<Idx,T>::at_const(const std::size_t arg_idx) const
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::getElementPointers(std::vector<T*>& ret_ptrs)
   {
-    if(NULL==front_)
-    { return NULL;  }
-    else
+    ret_ptrs.resize(size_);
+    if(flag_pos_valid_)
     {
-      if(arg_idx > size_)
-      { return NULL; }
-      const SMLNode<Idx,T> * t = front_;
-
-      for(std::size_t i=0; i<arg_idx; ++i)
-      {
-#ifdef DEBUG
-        assert(i<=size_);
-#endif
-
-        if(NULL==t)
-        { return NULL;  }
-        t = t->next_;
-      }
-      if(NULL==t)
-      { return NULL;  }
+      for(std::size_t i=0; i<size_; ++i)
+      { ret_ptrs[i] = pos_nodes_[i]->data_; }
+      return;
+    }
+    SMLNode<Idx,T> * t = front_;
+    for(std::size_t i=0; i<size_; ++i, t = t->next_)
+    { ret_ptrs[i] = t->data_; }
+    stats_.onWalk(size_);
+  }
 
-      return (const T*) t->data_;
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::getElementPointers(std::vector<const T*>& ret_ptrs) const
+  {
+    ret_ptrs.resize(size_);
+    if(flag_pos_valid_)
+    {
+      for(std::size_t i=0; i<size_; ++i)
+      { ret_ptrs[i] = pos_nodes_[i]->data_; }
+      return;
     }
+    const SMLNode<Idx,T> * t = front_;
+    for(std::size_t i=0; i<size_; ++i, t = t->next_)
+    { ret_ptrs[i] = t->data_; }
+    stats_.onWalk(size_);
   }
 
-  template <typename Idx, typename T>
-  const T* CMappedList<Idx,T>::at_const(const Idx & arg_idx) const
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  const T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::at_const(const Idx & arg_idx) const
   {
+    stats_.onLookup();
     if(NULL==front_)
     { return NULL;  }
     else
     {
-      if(map_.find(arg_idx) == map_.end())
-      {
-        return NULL;
-      }
-
-      const SMLNode<Idx,T> * t = map_.at(arg_idx);
+      const SMLNode<Idx,T> * t = map_.find(arg_idx);
 
       if(NULL==t)
       { return NULL;  }
@@ -976,95 +2187,37 @@ namespace sutil
   }
 
 
-  template <typename Idx, typename T>
-  bool CMappedList<Idx,T>::erase(const T* arg_t)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(const T* arg_t)
   {
     if((NULL==front_) || (NULL==arg_t))
     { return false;  }
 
-    SMLNode<Idx,T> * t, *tpre;
-
-    //Head is a special case
-    if(front_->data_ == arg_t)
-    {
-      t = front_;
-      front_ = front_->next_;
-      front_->prev_ = NULL;
-
-      if(NULL!= t->data_)
-      {
-        delete t->data_;
-        if(NULL!= t->id_)
-        {
-          map_.erase(*(t->id_));
-          delete t->id_;
-        }
-        delete t;
-        size_--;
-
-        if(0 == size_)
-        { back_ = NULL; null_.prev_=NULL; }
-
-        flag_is_sorted_ = false;
-
-        return true; // Deleted head.
-      }
-
-      return false;//Head was NULL --> Error condition.
-    }
-    else
-    {
-      //The head doesn't match.
-      tpre = front_;
-      t = front_->next_;
-
-      //Find the node
-      while(NULL!=t)
-      {
-        if(t->data_ == arg_t)
-        {
-          tpre->next_ = t->next_;
-          tpre->next_->prev_ = tpre;
-          if(NULL!= t->data_)
-          {
-            delete t->data_;
-            if(NULL!= t->id_)
-            {
-              map_.erase(*(t->id_));
-              delete t->id_;
-            }
-            if(back_ == t)//Removing the ending node; have to reassign
-            { back_ = tpre; }
-            delete t;
-            size_--;
-
-            if(0 == size_)
-            { back_ = NULL; null_.prev_=NULL; }
-
-            flag_is_sorted_ = false;
-
-            return true; // Deleted node.
-          }
-          else
-          { return false; }//Node to delete was NULL --> Error condition.
-        }
-        tpre = t;
-        t = t->next_;
-      }
-      return false; // Didn't delete anything.
-    }//End of if/else
+    //Find the node (O(1) with a node table)
+    SMLNode<Idx,T> * t = nodeOf(arg_t);
+    if(NULL == t)
+    { return false; } // Didn't delete anything.
+
+    if(NULL!= t->id_)
+    { map_.erase(*(t->id_)); }
+    unlinkNode(t);
+    alloc_.destroyNode(t);
+    stats_.onFree(nodeBytes()); stats_.onErase();
+    return true; // Deleted node.
   }
 
 
 
-  template <typename Idx, typename T>
-  bool CMappedList<Idx,T>::erase(const Idx& arg_idx)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(const Idx& arg_idx)
   {
+    stats_.onLookup();
     if(0>=size_)
     { return false;  }
 
     //Make sure the node exists
-    if(map_.find(arg_idx) == map_.end())
+    SMLNode<Idx,T> * node = map_.find(arg_idx);
+    if(NULL == node)
     {
 #ifdef DEBUG
       std::cerr<<"\nCMappedList<Idx,T>::erase() WARNING : Tried to erase a nonexistent entry";
@@ -1072,58 +2225,93 @@ namespace sutil
       return false;
     }
 
-    SMLNode<Idx,T> * node = map_[arg_idx];
-
-    if(1==size_)
-    {
-      if(front_!=node) { return false; } //This should never happen when Size 1 + idx exists.
+    map_.erase(arg_idx);
 
-      if(NULL!= front_->data_)
-      { delete front_->data_; }
-      if(NULL!= front_->id_)
-      { delete front_->id_;  }
-      delete front_;
+    unlinkNode(node);
+    alloc_.destroyNode(node);
+    stats_.onFree(nodeBytes()); stats_.onErase();
 
-      front_ = NULL; back_ = NULL; null_.prev_ = NULL;
-      node = NULL;
-    }
-    else
-    {//At least two nodes. Remove the node
-      if(NULL!= node->data_)
-      { delete node->data_; }
-      if(NULL!= node->id_)
-      { delete node->id_;  }
+    return true;
+  }
 
-      if(front_ == node)
-      {
-        front_ = front_->next_;
-        front_->prev_ = NULL;
-      }
-      else if(back_ == node)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename Pred>
+  std::size_t CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase_if(Pred arg_pred)
+  {
+    if(NULL == front_) { return 0; }
+
+    //Erasing elements doesn't reorder the rest. Keep the survivors'
+    //Idx (in order) as the sort order, overwriting it in place.
+    const bool sorted = flag_is_sorted_;
+    std::size_t n = 0, nwalk = 0, nkept = 0;
+    SMLNode<Idx,T> *t = front_, *tnext;
+    while(NULL != t && &null_ != t)
+    {
+      tnext = t->next_; //Read before t is unlinked
+      nwalk++;
+      if(arg_pred(static_cast<const T&>(*(t->data_))))
       {
-        back_ = back_->prev_;
-        back_->next_ = &null_;
-        null_.prev_ = back_;
+        map_.erase(*(t->id_));
+        unlinkNode(t);
+        alloc_.destroyNode(t);
+        stats_.onFree(nodeBytes()); stats_.onErase();
+        n++;
       }
-      else
+      else if(sorted)
       {
-        node->prev_->next_ = node->next_;
-        node->next_->prev_ = node->prev_;
+        if(nkept < sorting_order_.size()) { sorting_order_[nkept] = *(t->id_); }
+        else { sorting_order_.push_back(*(t->id_)); }
+        nkept++;
       }
-
-      delete node;
-      node = NULL;
+      t = tnext;
     }
+    stats_.onWalk(nwalk);
+    if(sorted)
+    {
+      sorting_order_.erase(sorting_order_.begin()+nkept, sorting_order_.end());
+      flag_is_sorted_ = true;
+    }
+    return n;
+  }
 
-    size_--;
-    map_.erase(arg_idx);
-    flag_is_sorted_ = false;
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename ForwardIt>
+  std::size_t CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(ForwardIt arg_first, ForwardIt arg_last)
+  {
+    const bool sorted = flag_is_sorted_;
+    std::size_t n = 0;
+    for(; arg_first != arg_last && 0 < size_; ++arg_first)
+    {
+      stats_.onLookup();
+      SMLNode<Idx,T> *node = map_.find(*arg_first);
+      if(NULL == node) { continue; } //Absent, or erased already
+      map_.erase(*(node->id_));
+      unlinkNode(node);
+      alloc_.destroyNode(node);
+      stats_.onFree(nodeBytes()); stats_.onErase();
+      n++;
+    }
+    if(0 < n) { keepSortedAfterErase(sorted); }
+    return n;
+  }
 
-    return true; // Deleted head.
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::keepSortedAfterErase(const bool arg_was_sorted)
+  {
+    if(false == arg_was_sorted) { flag_is_sorted_ = false; return; }
+    std::size_t nkept = 0;
+    for(SMLNode<Idx,T>* t = front_; NULL != t && &null_ != t; t = t->next_, ++nkept)
+    {
+      if(nkept < sorting_order_.size()) { sorting_order_[nkept] = *(t->id_); }
+      else { sorting_order_.push_back(*(t->id_)); }
+    }
+    stats_.onWalk(nkept);
+    sorting_order_.erase(sorting_order_.begin()+nkept, sorting_order_.end());
+    flag_is_sorted_ = true;
   }
 
-  template <typename Idx, typename T>
-  bool CMappedList<Idx,T>::clear()
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::clear()
   {
     SMLNode<Idx,T> *tpre;
     tpre = front_;
@@ -1132,6 +2320,7 @@ namespace sutil
     {
       size_=0;
       flag_is_sorted_ = false;
+      invalidatePositions();
       return true;
     } //Nothing in the list.
 
@@ -1139,11 +2328,8 @@ namespace sutil
 
     while(&null_ != tpre)
     {
-      if(NULL!=tpre->data_)
-      { delete tpre->data_; }
-      if(NULL!=tpre->id_)
-      { delete tpre->id_; }
-      delete tpre;
+      alloc_.destroyNode(tpre);
+      stats_.onFree(nodeBytes());
 
       tpre = front_;
       if(&null_ == tpre)//Reached the end.
@@ -1154,12 +2340,26 @@ namespace sutil
     size_=0;
     front_ = NULL; back_ = NULL; null_.prev_ = NULL;
     map_.clear(); // Clear the map.
+    node_table_.clear();
+    rank_.clear();
     flag_is_sorted_ = false; //Not ordered anymore
+    invalidatePositions();
     return true;
   }
 
-  template <typename Idx, typename T>
-  bool CMappedList<Idx,T>::sort(const std::vector<Idx> &arg_order)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::reserve(const std::size_t arg_n)
+  {
+    if(arg_n > size_) { alloc_.reserve(arg_n - size_); }
+    map_.reserve(arg_n);
+    node_table_.reserve(arg_n);
+    pos_nodes_.reserve(arg_n);
+    pos_table_.reserve(arg_n);
+    rank_.reserve(arg_n);
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::sort(const std::vector<Idx> &arg_order)
   {
     if(1>=size_)
     {//Already sorted.
@@ -1172,57 +2372,166 @@ namespace sutil
     if(arg_order.size() != size_)
     {
 #ifdef DEBUG
-      std::cout<<"\nCMappedList<Idx,T>::sort() ERROR : Number of indices in passed order doesn't match mapped list.";
+      std::cout<<"\nCMappedList<Idx,T,Alloc,Index>::sort() ERROR : Number of indices in passed order doesn't match mapped list.";
 #endif
       return false;
     }
 
-    //First check all the indices actually appear in the list.
+    //Find each index's current position (one lookup per element).
+    updatePositions();
+    std::vector<std::size_t> perm;
+    perm.reserve(size_);
     typename std::vector<Idx>::const_iterator it,ite;
     for(it = arg_order.begin(), ite = arg_order.end(); it!=ite; ++it)
     {
-      T* ptr = this->at(*it);
-      if(NULL == ptr)
+      SMLNode<Idx,T>* node = map_.find(*it);
+      std::size_t pos;
+      if(NULL == node || false == pos_table_.find(node->data_, pos))
       {
 #ifdef DEBUG
-      std::cout<<"\nCMappedList<Idx,T>::sort() ERROR : Passed order contains invalid index element.";
+      std::cout<<"\nCMappedList<Idx,T,Alloc,Index>::sort() ERROR : Passed order contains invalid index element.";
 #endif
         return false;
       }
+      perm.push_back(pos);
     }
 
-    // Verified that all the elements are in the mapped list
-    // So proceed to insertion sort.
-    for(it = arg_order.begin(), ite = arg_order.end(); it!=ite; ++it)
-    {
-      // Find the node, starting from idx 0 to end.
-      SMLNode<Idx,T>* node = map_[*it]; //Idx is already tested to exist in the map.
+    //Rejects repeated indices too.
+    return applyPermutation(perm);
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename Compare>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::sort(Compare arg_comp)
+  {
+    if(1>=size_)
+    {//Already sorted.
+      flag_is_sorted_ = true;
+      sorting_order_.clear();
+      if(1 == size_) { sorting_order_.push_back(*(front_->id_)); }
+      return true;
+    }
 
-      if(node==back_) { continue;   } //Nothing to do. Node is already in the right place.
+    //Bottom up merge sort of the (null terminated) singly linked list.
+    //Merges runs of length 1, 2, 4 ... until one run remains. The prev_
+    //links are rebuilt as the nodes are merged.
+    back_->next_ = NULL;
+    SMLNode<Idx,T> *list = front_, *tail = NULL;
+    for(std::size_t insize = 1; ; insize *= 2)
+    {
+      SMLNode<Idx,T> *p = list, *q, *e;
+      list = NULL; tail = NULL;
+      std::size_t nmerges = 0;
 
-      // Detach the node from the list.
-      if(node==front_)
+      while(NULL != p)
       {
-        node->next_->prev_ = NULL;
-        front_ = node->next_;
+        nmerges++;
+        //Step q ahead by insize nodes (p's run)
+        q = p;
+        std::size_t psize = 0, qsize = insize;
+        for(std::size_t i=0; i<insize && NULL != q; ++i)
+        { psize++; q = q->next_; }
+
+        //Merge the p and q runs. Prefer p on ties (stable).
+        while(0 < psize || (0 < qsize && NULL != q))
+        {
+          if(0 == psize)
+          { e = q; q = q->next_; qsize--; }
+          else if(0 == qsize || NULL == q || false == arg_comp(*(q->data_), *(p->data_)))
+          { e = p; p = p->next_; psize--; }
+          else
+          { e = q; q = q->next_; qsize--; }
+
+          if(NULL != tail) { tail->next_ = e; }
+          else { list = e; }
+          e->prev_ = tail;
+          tail = e;
+        }
+        p = q;
       }
-      else
+      tail->next_ = NULL;
+      if(1 >= nmerges) { break; }
+    }
+
+    front_ = list;
+    back_ = tail;
+    back_->next_ = &null_;
+    null_.prev_ = back_;
+
+    //Record the new order
+    sorting_order_.clear();
+    sorting_order_.reserve(size_);
+    for(SMLNode<Idx,T>* n = front_; &null_ != n; n = n->next_)
+    { sorting_order_.push_back(*(n->id_)); }
+    flag_is_sorted_ = true;
+    rank_.onReorder(front_, size_);
+    invalidatePositions();
+    return true;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::applyPermutation(const std::vector<std::size_t>& arg_perm)
+  {
+    if(arg_perm.size() != size_)
+    {
+#ifdef DEBUG
+      std::cerr<<"\nCMappedList<Idx,T,Alloc,Index>::applyPermutation() ERROR : Permutation size doesn't match mapped list.";
+#endif
+      return false;
+    }
+    if(0 == size_)
+    {
+      flag_is_sorted_ = true;
+      sorting_order_.clear();
+      return true;
+    }
+
+    //Check that each position appears exactly once
+    std::vector<bool> seen(size_, false);
+    std::vector<std::size_t>::const_iterator it,ite;
+    for(it = arg_perm.begin(), ite = arg_perm.end(); it!=ite; ++it)
+    {
+      if(*it >= size_ || seen[*it])
       {
-        node->prev_->next_ = node->next_;
-        node->next_->prev_ = node->prev_;
+#ifdef DEBUG
+        std::cerr<<"\nCMappedList<Idx,T,Alloc,Index>::applyPermutation() ERROR : Not a permutation (out of range or repeated position).";
+#endif
+        return false;
       }
+      seen[*it] = true;
+    }
+
+    updatePositions();
+    std::vector<SMLNode<Idx,T>*> nodes;
+    nodes.reserve(size_);
+    for(it = arg_perm.begin(), ite = arg_perm.end(); it!=ite; ++it)
+    { nodes.push_back(pos_nodes_[*it]); }
 
-      // Re-add the node at the end.
-      back_->next_ = node;
-      node->prev_ = back_;
-      back_ = node;
-      null_.prev_ = node;
-      node->next_ = &null_;
+    relinkInOrder(nodes);
+    return true;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  void CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::relinkInOrder(
+      const std::vector<SMLNode<Idx,T>*>& arg_nodes)
+  {
+    const std::size_t n = arg_nodes.size();
+    sorting_order_.clear();
+    sorting_order_.reserve(n);
+    for(std::size_t i=0; i<n; ++i)
+    {
+      SMLNode<Idx,T>* node = arg_nodes[i];
+      node->prev_ = (0 == i) ? NULL : arg_nodes[i-1];
+      node->next_ = (n-1 == i) ? &null_ : arg_nodes[i+1];
+      sorting_order_.push_back(*(node->id_));
     }
+    front_ = arg_nodes[0];
+    back_ = arg_nodes[n-1];
+    null_.prev_ = back_;
 
     flag_is_sorted_ = true;
-    sorting_order_ = arg_order;
-    return true;
+    rank_.onReorder(front_, size_);
+    invalidatePositions();
   }
 }
 
@@ -0,0 +1,133 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListAllocInline.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTALLOCINLINE_HPP_
+#define CMAPPEDLISTALLOCINLINE_HPP_
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListAllocSlab.hpp>
+
+#include <type_traits>
+#include <new>
+#include <utility>
+
+namespace sutil
+{
+  /** A linked list node that also holds its data and index.
+   *
+   * The data_ and id_ pointers of the base node point into the
+   * node itself, so the list's iterators work unchanged. The data
+   * follows the link pointers directly, so walking the list and
+   * dereferencing each element touches a single block of memory. */
+  template <typename IdxS, typename TS>
+  class SMLNodeInline : public SMLNode<IdxS,TS>
+  {
+  public:
+    /** Storage for the data (constructed in place) */
+    typename std::aligned_storage<sizeof(TS), alignof(TS)>::type data_store_;
+
+    /** Storage for the index (constructed in place) */
+    typename std::aligned_storage<sizeof(IdxS), alignof(IdxS)>::type id_store_;
+
+    SMLNodeInline() : SMLNode<IdxS,TS>() {}
+
+    /** Whether the data lives in this node (else it was adopted) */
+    bool isDataInline() const
+    { return static_cast<const void*>(this->data_) == static_cast<const void*>(&data_store_); }
+  };
+
+  /** A CMappedList allocation policy that stores each node's data
+   * and index in the same (aligned) block as the node's links. The
+   * blocks are taken from a slab pool, so a create costs one free-list
+   * pop and nodes created together are adjacent in memory.
+   *
+   * Use this for lists that are iterated a lot (tree linking, per-tick
+   * dynamics passes etc.). Iterating then costs one cache miss per
+   * element instead of two.
+   *
+   * Usage:
+   *   sutil::CMappedTree<std::string, SNode,
+   *     sutil::CMappedListAllocInline<std::string,SNode> > tree;
+   *
+   * NOTE : insert() still adopts the passed pointer (which must have
+   *        been allocated with new). Such a node's data lives outside
+   *        the block, and is deleted when the node is erased. */
+  template <typename Idx, typename T>
+  class CMappedListAllocInline
+  {
+  public:
+    CMappedListAllocInline() :
+      pool_(sizeof(SMLNodeInline<Idx,T>), alignof(SMLNodeInline<Idx,T>)) {}
+
+    template <typename I, typename... Args>
+    SMLNode<Idx,T>* createNode(I&& arg_idx, Args&&... arg_args)
+    {
+      void *n = pool_.allocate();
+      if(NULL == n) { return NULL; }
+      SMLNodeInline<Idx,T>* node = new(n) SMLNodeInline<Idx,T>();
+      node->data_ = new(&node->data_store_) T(std::forward<Args>(arg_args)...);
+      node->id_ = new(&node->id_store_) Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    template <typename I>
+    SMLNode<Idx,T>* adoptNode(I&& arg_idx, T* arg_t)
+    {
+      void *n = pool_.allocate();
+      if(NULL == n) { return NULL; }
+      SMLNodeInline<Idx,T>* node = new(n) SMLNodeInline<Idx,T>();
+      node->data_ = arg_t;
+      node->id_ = new(&node->id_store_) Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    void destroyNode(SMLNode<Idx,T>* arg_node)
+    {
+      SMLNodeInline<Idx,T>* node = static_cast<SMLNodeInline<Idx,T>*>(arg_node);
+      if(NULL != node->data_)
+      {
+        if(node->isDataInline())
+        { node->data_->~T();  }
+        else
+        { delete node->data_; }
+      }
+      if(NULL != node->id_)
+      { node->id_->~Idx(); }
+      node->~SMLNodeInline<Idx,T>();
+      pool_.deallocate(node);
+    }
+
+    void swap(CMappedListAllocInline<Idx,T>& arg_swap_obj)
+    { pool_.swap(arg_swap_obj.pool_); }
+
+    /** Makes room for arg_n more nodes (in one chunk) */
+    void reserve(const std::size_t arg_n)
+    { pool_.reserve(arg_n); }
+
+    /** The number of live nodes in the pool */
+    std::size_t getNumNodes() const
+    { return pool_.getNumBlocksInUse(); }
+
+    /** The number of heap allocations made so far */
+    std::size_t getNumChunks() const
+    { return pool_.getNumChunks(); }
+
+    /** The size of a node (with its data and index) in memory */
+    std::size_t getBlockSize() const
+    { return pool_.getBlockSize(); }
+
+  private:
+    CSlabPool pool_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTALLOCINLINE_HPP_*/
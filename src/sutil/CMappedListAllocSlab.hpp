@@ -0,0 +1,310 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListAllocSlab.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTALLOCSLAB_HPP_
+#define CMAPPEDLISTALLOCSLAB_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#ifdef DEBUG
+#include <iostream>
+#endif
+
+namespace sutil
+{
+  /** A pool of fixed-size memory blocks.
+   *
+   * Blocks are carved out of large chunks, and freed blocks are
+   * kept on a free list and reused by the next allocation. Chunks
+   * are never moved or released until the pool is destroyed, so a
+   * block's address is stable for as long as it is in use.
+   *
+   * Each new chunk is twice the size of the previous one (up to a
+   * cap), which keeps the number of heap allocations logarithmic in
+   * the number of blocks.
+   *
+   * NOTE : The pool only hands out raw memory. Constructing and
+   *        destroying objects in it is the caller's job. */
+  class CSlabPool
+  {
+  public:
+    /** Block size and alignment are fixed for the pool's lifetime */
+    CSlabPool(const std::size_t arg_block_size,
+        const std::size_t arg_block_align = sizeof(void*),
+        const std::size_t arg_blocks_per_chunk = 32) :
+          align_(arg_block_align < sizeof(void*) ? sizeof(void*) : arg_block_align),
+          next_chunk_blocks_(arg_blocks_per_chunk < 1 ? 1 : arg_blocks_per_chunk),
+          free_(NULL), bump_(NULL), bump_end_(NULL), blocks_in_use_(0)
+    {
+      //Each block must be able to hold a free-list link, and must
+      //keep the next block aligned.
+      block_size_ = arg_block_size < sizeof(SFreeBlock) ? sizeof(SFreeBlock) : arg_block_size;
+      block_size_ = ((block_size_ + align_ - 1) / align_) * align_;
+    }
+
+    /** Releases all the chunks. Any objects still in the pool
+     * must have been destroyed already. */
+    ~CSlabPool()
+    {
+      std::vector<char*>::iterator it,ite;
+      for(it = chunks_.begin(), ite = chunks_.end(); it!=ite; ++it)
+      { ::operator delete(static_cast<void*>(*it)); }
+      chunks_.clear();
+    }
+
+    /** Returns a block (reuses freed blocks first). NULL on failure. */
+    void* allocate()
+    {
+      void* ret;
+      if(NULL != free_)
+      {
+        ret = static_cast<void*>(free_);
+        free_ = free_->next_;
+      }
+      else
+      {
+        if(bump_ == bump_end_)
+        {
+          if(false == addChunk(next_chunk_blocks_))
+          { return NULL; }
+        }
+        ret = static_cast<void*>(bump_);
+        bump_ += block_size_;
+      }
+      blocks_in_use_++;
+      return ret;
+    }
+
+    /** Returns a block to the free list */
+    void deallocate(void* arg_ptr)
+    {
+      if(NULL == arg_ptr) { return; }
+      SFreeBlock* b = static_cast<SFreeBlock*>(arg_ptr);
+      b->next_ = free_;
+      free_ = b;
+      blocks_in_use_--;
+    }
+
+    /** Makes sure that the next arg_n allocations will not
+     * require a heap allocation. */
+    bool reserve(const std::size_t arg_n)
+    {
+      std::size_t avail = static_cast<std::size_t>(bump_end_ - bump_) / block_size_;
+      for(SFreeBlock* b = free_; NULL != b && avail < arg_n; b = b->next_)
+      { avail++; }
+      if(avail >= arg_n) { return true; }
+
+      //Hand the remainder of the current chunk to the free list
+      //so it isn't lost when we switch to the new chunk.
+      while(bump_ != bump_end_)
+      {
+        SFreeBlock* b = reinterpret_cast<SFreeBlock*>(bump_);
+        b->next_ = free_;
+        free_ = b;
+        bump_ += block_size_;
+      }
+      return addChunk(arg_n - avail);
+    }
+
+    /** Exchanges all the memory with another pool */
+    void swap(CSlabPool& arg_swap_obj)
+    {
+      std::swap(block_size_, arg_swap_obj.block_size_);
+      std::swap(align_, arg_swap_obj.align_);
+      std::swap(next_chunk_blocks_, arg_swap_obj.next_chunk_blocks_);
+      chunks_.swap(arg_swap_obj.chunks_);
+      std::swap(free_, arg_swap_obj.free_);
+      std::swap(bump_, arg_swap_obj.bump_);
+      std::swap(bump_end_, arg_swap_obj.bump_end_);
+      std::swap(blocks_in_use_, arg_swap_obj.blocks_in_use_);
+    }
+
+    /** The size of each block (after padding for alignment) */
+    std::size_t getBlockSize() const
+    { return block_size_; }
+
+    /** The number of blocks that have been handed out and not returned */
+    std::size_t getNumBlocksInUse() const
+    { return blocks_in_use_; }
+
+    /** The number of chunks (heap allocations) the pool holds */
+    std::size_t getNumChunks() const
+    { return chunks_.size(); }
+
+  private:
+    /** A free block stores the link to the next free block */
+    struct SFreeBlock { SFreeBlock* next_; };
+
+    /** Allocates a new chunk and points the bump allocator at it */
+    bool addChunk(const std::size_t arg_blocks)
+    {
+      //Over-allocate so that the first block can be aligned.
+      char* chunk = static_cast<char*>(::operator new(
+          arg_blocks * block_size_ + align_, std::nothrow));
+      if(NULL == chunk)
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCSlabPool::addChunk() : Error. Could not allocate a chunk.";
+#endif
+        return false;
+      }
+      chunks_.push_back(chunk);
+
+      std::size_t misalign = reinterpret_cast<std::size_t>(chunk) % align_;
+      bump_ = chunk + (misalign ? align_ - misalign : 0);
+      bump_end_ = bump_ + arg_blocks * block_size_;
+
+      //Grow geometrically, but don't let chunks get absurdly large.
+      if(next_chunk_blocks_ < 4096) { next_chunk_blocks_ *= 2; }
+      return true;
+    }
+
+    std::size_t block_size_;
+    std::size_t align_;
+    std::size_t next_chunk_blocks_;
+
+    /** All the chunks allocated so far */
+    std::vector<char*> chunks_;
+
+    /** The head of the free list */
+    SFreeBlock* free_;
+
+    /** The unused part of the most recent chunk */
+    char *bump_, *bump_end_;
+
+    std::size_t blocks_in_use_;
+
+    CSlabPool(const CSlabPool&);
+    CSlabPool& operator = (const CSlabPool&);
+  };
+
+  /** A CMappedList allocation policy that takes nodes, data and
+   * indices from slab pools instead of the heap.
+   *
+   * A create/erase cycle then costs a few free-list pushes and pops
+   * instead of three mallocs and three frees, and nodes created together
+   * end up next to each other in memory.
+   *
+   * Usage:
+   *   sutil::CMappedList<std::string, double,
+   *     sutil::CMappedListAllocSlab<std::string,double> > list;
+   *   sutil::CMappedTree<std::string, SNode,
+   *     sutil::CMappedListAllocSlab<std::string,SNode> > tree;
+   *
+   * NOTE : Objects passed to insert() must still be allocated with new.
+   *        They are deleted (not returned to the pool) when erased. */
+  template <typename Idx, typename T>
+  class CMappedListAllocSlab
+  {
+  public:
+    CMappedListAllocSlab() :
+      pool_node_(sizeof(SNode), alignof(SNode)),
+      pool_data_(sizeof(T), alignof(T)),
+      pool_idx_(sizeof(Idx), alignof(Idx)) {}
+
+    template <typename I, typename... Args>
+    SMLNode<Idx,T>* createNode(I&& arg_idx, Args&&... arg_args)
+    {
+      void *n = pool_node_.allocate(), *d = pool_data_.allocate(), *i = pool_idx_.allocate();
+      if(NULL == n || NULL == d || NULL == i)
+      {
+        pool_node_.deallocate(n); pool_data_.deallocate(d); pool_idx_.deallocate(i);
+        return NULL;
+      }
+      SNode* node = new(n) SNode();
+      node->data_ = new(d) T(std::forward<Args>(arg_args)...);
+      node->id_ = new(i) Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    template <typename I>
+    SMLNode<Idx,T>* adoptNode(I&& arg_idx, T* arg_t)
+    {
+      void *n = pool_node_.allocate(), *i = pool_idx_.allocate();
+      if(NULL == n || NULL == i)
+      {
+        pool_node_.deallocate(n); pool_idx_.deallocate(i);
+        return NULL;
+      }
+      SNode* node = new(n) SNode();
+      node->adopted_ = true;
+      node->data_ = arg_t;
+      node->id_ = new(i) Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    void destroyNode(SMLNode<Idx,T>* arg_node)
+    {
+      SNode* node = static_cast<SNode*>(arg_node);
+      if(NULL != node->data_)
+      {
+        if(node->adopted_)
+        { delete node->data_;  }
+        else
+        {
+          node->data_->~T();
+          pool_data_.deallocate(node->data_);
+        }
+      }
+      if(NULL != node->id_)
+      {
+        node->id_->~Idx();
+        pool_idx_.deallocate(node->id_);
+      }
+      node->~SNode();
+      pool_node_.deallocate(node);
+    }
+
+    void swap(CMappedListAllocSlab<Idx,T>& arg_swap_obj)
+    {
+      pool_node_.swap(arg_swap_obj.pool_node_);
+      pool_data_.swap(arg_swap_obj.pool_data_);
+      pool_idx_.swap(arg_swap_obj.pool_idx_);
+    }
+
+    /** Makes room for arg_n more nodes (one chunk per pool) */
+    void reserve(const std::size_t arg_n)
+    {
+      pool_node_.reserve(arg_n);
+      pool_data_.reserve(arg_n);
+      pool_idx_.reserve(arg_n);
+    }
+
+    /** The number of live nodes in the pool */
+    std::size_t getNumNodes() const
+    { return pool_node_.getNumBlocksInUse(); }
+
+    /** The number of heap allocations made so far */
+    std::size_t getNumChunks() const
+    { return pool_node_.getNumChunks() + pool_data_.getNumChunks() + pool_idx_.getNumChunks(); }
+
+  private:
+    /** Remembers whether the data came from the pool or from insert() */
+    struct SNode : public SMLNode<Idx,T>
+    {
+      bool adopted_;
+      SNode() : SMLNode<Idx,T>(), adopted_(false) {}
+    };
+
+    CSlabPool pool_node_;
+    CSlabPool pool_data_;
+    CSlabPool pool_idx_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTALLOCSLAB_HPP_*/
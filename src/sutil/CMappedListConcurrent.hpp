@@ -0,0 +1,439 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListConcurrent.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTCONCURRENT_HPP_
+#define CMAPPEDLISTCONCURRENT_HPP_
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+
+#ifdef DEBUG
+#include <iostream>
+#endif
+
+namespace sutil
+{
+  /** A mapped list that many threads can read while one thread
+   * (at a time) changes it.
+   *
+   * Readers never block or retry : A lookup announces the reader's
+   * epoch, binary searches an immutable snapshot of the index and
+   * clears the announcement. Iterating walks the linked list.
+   *
+   * Writers are serialized by a mutex. Each change publishes a new
+   * copy of the index (so writes are O(n), which suits read-mostly
+   * data). Erased nodes and old indices are retired, and freed once
+   * no reader that could still see them is active (epoch based
+   * reclamation).
+   *
+   * Usage (each reader thread makes its own CReader) :
+   *   sutil::CMappedListConcurrent<std::string,double> list;
+   *   list.create("q0", 0.1);                            //Writer
+   *   sutil::CMappedListConcurrent<std::string,double>::CReader rd(list);
+   *   double q;
+   *   if(rd.get("q0", q)) {...}                          //Reader
+   *
+   * NOTE : Elements can't be changed in place (readers may be using
+   *        them). Use update() to replace an element.
+   *
+   * NOTE 2 : Idx must support operator <. At most arg_max_readers
+   *          (passed to the constructor) CReaders may exist at once. */
+  template <typename Idx, typename T>
+  class CMappedListConcurrent
+  {
+  private:
+    /** A node in the (singly linked, for readers) list */
+    struct SNode
+    {
+      Idx id_;
+      T data_;
+      std::atomic<SNode*> next_;
+      /** Only used by the writer (to unlink in O(1)) */
+      SNode* prev_;
+      SNode(const Idx& arg_idx, const T& arg_t) :
+        id_(arg_idx), data_(arg_t), next_(NULL), prev_(NULL) {}
+    };
+
+    /** An immutable, sorted (idx, node) array */
+    typedef std::vector<std::pair<Idx, SNode*> > SIndex;
+
+    struct SEntryLess
+    {
+      bool operator()(const std::pair<Idx, SNode*>& arg_a, const Idx& arg_b) const
+      { return arg_a.first < arg_b; }
+    };
+
+    /** A reader's announced epoch. Padded to a cache line so
+     * readers don't slow each other down. */
+    struct SSlot
+    {
+      std::atomic<unsigned long long> epoch_;
+      std::atomic<bool> in_use_;
+      char pad_[64 - sizeof(std::atomic<unsigned long long>) - sizeof(std::atomic<bool>)];
+      SSlot() : epoch_(s_idle), in_use_(false) {}
+    };
+
+    /** Memory that was unlinked at an epoch */
+    struct SRetired
+    {
+      unsigned long long epoch_;
+      SNode* node_;
+      SIndex* index_;
+    };
+
+    static const unsigned long long s_idle = ~0ULL;
+
+  public:
+    /** A reader's handle. Claims one of the list's reader slots for
+     * its lifetime. Use each CReader from one thread only. */
+    class CReader
+    {
+    public:
+      explicit CReader(CMappedListConcurrent<Idx,T>& arg_list) :
+        list_(arg_list), slot_(NULL), depth_(0)
+      {
+        typename std::vector<SSlot>::iterator it,ite;
+        for(it = list_.slots_.begin(), ite = list_.slots_.end(); it!=ite; ++it)
+        {
+          bool expected = false;
+          if(it->in_use_.compare_exchange_strong(expected, true))
+          { slot_ = &(*it); break; }
+        }
+#ifdef DEBUG
+        if(NULL == slot_)
+        { std::cerr<<"\nCMappedListConcurrent::CReader() : Error. All the reader slots are taken."; }
+#endif
+      }
+
+      ~CReader()
+      {
+        if(NULL == slot_) { return; }
+        slot_->epoch_.store(s_idle);
+        slot_->in_use_.store(false);
+      }
+
+      /** Whether this reader got a slot (else it can't read) */
+      bool isValid() const
+      { return NULL != slot_; }
+
+      /** Starts a read section. Pointers returned by at() and the
+       * elements visited by forEach() stay valid until the matching
+       * unlock(). Sections may be nested. Wait free.
+       * Returns false (and starts nothing) if the reader has no slot. */
+      bool lock()
+      {
+        if(NULL == slot_) { return false; }
+        if(0 == depth_++)
+        { slot_->epoch_.store(list_.epoch_.load()); }
+        return true;
+      }
+
+      /** Ends a read section */
+      void unlock()
+      {
+        if(NULL == slot_ || 0 == depth_) { return; }
+        if(0 == --depth_)
+        { slot_->epoch_.store(s_idle); }
+      }
+
+      /** Idx based lookup. Only call this between lock() and unlock().
+       * Returns NULL if idx isn't in the list (or the reader has no
+       * slot, and so can't read safely). */
+      const T* at(const Idx& arg_idx) const
+      {
+        if(NULL == slot_) { return NULL; }
+        const SIndex* index = list_.index_.load();
+        typename SIndex::const_iterator it = std::lower_bound(index->begin(),
+            index->end(), arg_idx, SEntryLess());
+        if(it == index->end() || arg_idx < it->first) { return NULL; }
+        return &(it->second->data_);
+      }
+
+      /** Copies the element at idx into ret_t. False if absent. */
+      bool get(const Idx& arg_idx, T& ret_t)
+      {
+        if(NULL == slot_) { return false; }
+        lock();
+        const T* t = at(arg_idx);
+        if(NULL != t) { ret_t = *t; }
+        unlock();
+        return NULL != t;
+      }
+
+      /** Calls arg_f(const Idx&, const T&) on each element in list
+       * order. Returns the number of elements visited. */
+      template <typename F>
+      std::size_t forEach(F arg_f)
+      {
+        if(NULL == slot_) { return 0; }
+        std::size_t n = 0;
+        lock();
+        for(const SNode* node = list_.front_.load(); NULL != node; node = node->next_.load(), ++n)
+        { arg_f(node->id_, node->data_); }
+        unlock();
+        return n;
+      }
+
+      /** The number of elements (in the reader's snapshot) */
+      std::size_t size()
+      {
+        if(NULL == slot_) { return 0; }
+        lock();
+        std::size_t n = list_.index_.load()->size();
+        unlock();
+        return n;
+      }
+
+    private:
+      CMappedListConcurrent<Idx,T>& list_;
+      SSlot* slot_;
+      unsigned int depth_;
+
+      CReader(const CReader&);
+      CReader& operator = (const CReader&);
+    };
+
+    explicit CMappedListConcurrent(const std::size_t arg_max_readers = 64) :
+      front_(NULL), back_(NULL), index_(new SIndex()), epoch_(1),
+      slots_(arg_max_readers) {}
+
+    /** Frees everything. No readers may be active. */
+    ~CMappedListConcurrent()
+    {
+      SNode* node = front_.load();
+      while(NULL != node)
+      {
+        SNode* tmp = node->next_.load();
+        delete node;
+        node = tmp;
+      }
+      delete index_.load();
+      freeRetired(s_idle);
+    }
+
+    /** Copies an element into the list (at the front by default, else
+     * at the back). Returns false if idx exists. */
+    bool create(const Idx& arg_idx, const T& arg_t, const bool insert_at_start=true)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const SIndex* old = index_.load();
+      typename SIndex::const_iterator pos = std::lower_bound(old->begin(),
+          old->end(), arg_idx, SEntryLess());
+      if(pos != old->end() && false == (arg_idx < pos->first))
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedListConcurrent::create() : Error. Idx exists. Tried to add duplicate entry";
+#endif
+        return false;
+      }
+
+      SNode* node = new SNode(arg_idx, arg_t);
+      SIndex* index = new SIndex();
+      index->reserve(old->size()+1);
+      index->insert(index->end(), old->begin(), pos);
+      index->push_back(std::make_pair(arg_idx, node));
+      index->insert(index->end(), pos, old->end());
+
+      //Link the node (it is complete before readers can reach it)
+      if(NULL == back_)
+      { back_ = node; front_.store(node); }
+      else if(insert_at_start)
+      {
+        SNode* front = front_.load();
+        node->next_.store(front);
+        front->prev_ = node;
+        front_.store(node);
+      }
+      else
+      {
+        node->prev_ = back_;
+        back_->next_.store(node);
+        back_ = node;
+      }
+
+      publish(index, NULL);
+      return true;
+    }
+
+    /** Replaces the element at idx (readers see the old or the new
+     * element, never a partial one). Returns false if idx is absent. */
+    bool update(const Idx& arg_idx, const T& arg_t)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const SIndex* old = index_.load();
+      typename SIndex::const_iterator pos = std::lower_bound(old->begin(),
+          old->end(), arg_idx, SEntryLess());
+      if(pos == old->end() || arg_idx < pos->first) { return false; }
+
+      SNode *old_node = pos->second, *node = new SNode(arg_idx, arg_t);
+      SIndex* index = new SIndex(*old);
+      (*index)[pos - old->begin()].second = node;
+
+      //Splice the new node in place of the old one
+      node->prev_ = old_node->prev_;
+      node->next_.store(old_node->next_.load());
+      if(NULL != node->next_.load()) { node->next_.load()->prev_ = node; }
+      else { back_ = node; }
+      if(NULL != node->prev_) { node->prev_->next_.store(node); }
+      else { front_.store(node); }
+
+      publish(index, old_node);
+      return true;
+    }
+
+    /** Removes an element. Returns false if idx is absent. */
+    bool erase(const Idx& arg_idx)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const SIndex* old = index_.load();
+      typename SIndex::const_iterator pos = std::lower_bound(old->begin(),
+          old->end(), arg_idx, SEntryLess());
+      if(pos == old->end() || arg_idx < pos->first) { return false; }
+
+      SNode* node = pos->second;
+      SIndex* index = new SIndex();
+      index->reserve(old->size()-1);
+      index->insert(index->end(), old->begin(), pos);
+      index->insert(index->end(), pos+1, old->end());
+
+      //Unlink. The node's own next_ is left alone so readers standing
+      //on it can move on.
+      SNode* next = node->next_.load();
+      if(NULL != next) { next->prev_ = node->prev_; }
+      else { back_ = node->prev_; }
+      if(NULL != node->prev_) { node->prev_->next_.store(next); }
+      else { front_.store(next); }
+
+      publish(index, node);
+      return true;
+    }
+
+    /** Removes all the elements */
+    void clear()
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      SNode* node = front_.load();
+      front_.store(NULL);
+      back_ = NULL;
+      publish(new SIndex(), NULL);
+
+      //The nodes were unlinked at the epoch publish() just retired.
+      const unsigned long long e = epoch_.load() - 1;
+      while(NULL != node)
+      {
+        SRetired r; r.epoch_ = e; r.node_ = node; r.index_ = NULL;
+        retired_.push_back(r);
+        node = node->next_.load();
+      }
+      reclaimRetired();
+    }
+
+    /** The number of elements (may change right after the call) */
+    std::size_t size() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return index_.load()->size();
+    }
+
+    /** The number of retired nodes and indices not yet freed */
+    std::size_t getNumRetired() const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return retired_.size();
+    }
+
+    /** Frees the retired memory that no reader can still see. Every
+     * change calls this, but a writer may call it after readers finish
+     * to free memory early. */
+    void reclaim()
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      reclaimRetired();
+    }
+
+  private:
+    /** Implements reclaim(). Must hold mutex_. */
+    void reclaimRetired()
+    {
+      //Readers that announced an epoch before a retirement may still
+      //see it. Idle readers can't.
+      unsigned long long min = s_idle;
+      typename std::vector<SSlot>::const_iterator it,ite;
+      for(it = slots_.begin(), ite = slots_.end(); it!=ite; ++it)
+      {
+        unsigned long long e = it->epoch_.load();
+        if(e < min) { min = e; }
+      }
+      freeRetired(min);
+    }
+
+    /** Publishes a new index and retires the old one (and the passed
+     * node, which must already be unlinked). Must hold mutex_. */
+    void publish(SIndex* arg_index, SNode* arg_node)
+    {
+      SIndex* old = index_.exchange(arg_index);
+      SRetired r;
+      //Readers that load the epoch after this can't see old or arg_node
+      r.epoch_ = epoch_.fetch_add(1);
+      r.node_ = arg_node;
+      r.index_ = old;
+      retired_.push_back(r);
+      reclaimRetired();
+    }
+
+    /** Frees all the memory retired before (ie. at an epoch less than)
+     * arg_min_epoch */
+    void freeRetired(const unsigned long long arg_min_epoch)
+    {
+      std::size_t j = 0;
+      for(std::size_t i=0; i<retired_.size(); ++i)
+      {
+        if(retired_[i].epoch_ < arg_min_epoch)
+        {
+          delete retired_[i].node_;
+          delete retired_[i].index_;
+        }
+        else
+        { retired_[j++] = retired_[i]; }
+      }
+      retired_.resize(j);
+    }
+
+    /** The list (readers walk front_ and next_) */
+    std::atomic<SNode*> front_;
+    SNode* back_;
+
+    /** The current index. Replaced (never changed) by writers. */
+    std::atomic<SIndex*> index_;
+
+    /** The global epoch. Incremented on each change. */
+    std::atomic<unsigned long long> epoch_;
+
+    /** One slot per reader */
+    std::vector<SSlot> slots_;
+
+    /** Unlinked memory waiting to be freed */
+    std::vector<SRetired> retired_;
+
+    /** Serializes the writers */
+    mutable std::mutex mutex_;
+
+    CMappedListConcurrent(const CMappedListConcurrent&);
+    CMappedListConcurrent& operator = (const CMappedListConcurrent&);
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTCONCURRENT_HPP_*/
@@ -0,0 +1,184 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListFrozen.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTFROZEN_HPP_
+#define CMAPPEDLISTFROZEN_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace sutil
+{
+  /** A read-only, contiguous snapshot of a CMappedList.
+   *
+   * compile() copies the list's elements into one array (in the
+   * list's iteration order) and its indices into a sorted array.
+   * Iterating is then a plain array walk (which the compiler can
+   * vectorize), and Idx lookups are a binary search over contiguous
+   * keys instead of a walk through scattered map nodes.
+   *
+   * Use this for models that are built once and then read at a high
+   * rate (eg. in a servo loop).
+   *
+   * Usage:
+   *   sutil::CMappedList<std::string,double> list;
+   *   ... Create and sort the list ...
+   *   sutil::CMappedListFrozen<std::string,double> view;
+   *   view.compile(list);
+   *   for(const double *it = view.begin(); it != view.end(); ++it) {...}
+   *
+   * NOTE : The snapshot holds copies. It doesn't see changes made
+   *        to the list's elements after compile(). Any node being
+   *        added, removed or reordered makes it stale (see isValid()),
+   *        and it should then be compiled again.
+   *
+   * NOTE 2 : Idx must support operator <. The list must outlive
+   *          the snapshot for isValid() to be used. */
+  template <typename Idx, typename T>
+  class CMappedListFrozen
+  {
+  public:
+    CMappedListFrozen() : list_(NULL), version_(0) {}
+
+    /** Copies the passed list into the snapshot. Replaces any
+     * earlier contents. */
+    template <typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+    bool compile(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_list)
+    {
+      clear();
+      const std::size_t n = arg_list.size();
+      data_.reserve(n); ids_.reserve(n);
+
+      typename CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::const_iterator it,ite;
+      for(it = arg_list.begin(), ite = arg_list.end(); it!=ite; ++it)
+      {
+        data_.push_back(*it);
+        ids_.push_back(!it); //The iterator's node holds the Idx
+      }
+
+      //Sort the (key, position) pairs by key for binary search
+      std::vector<std::pair<Idx,std::size_t> > tmp;
+      tmp.reserve(n);
+      for(std::size_t i=0; i<n; ++i)
+      { tmp.push_back(std::make_pair(ids_[i], i)); }
+      std::sort(tmp.begin(), tmp.end(), SKeyLess());
+
+      keys_.reserve(n); key_pos_.reserve(n);
+      for(std::size_t i=0; i<n; ++i)
+      {
+        keys_.push_back(tmp[i].first);
+        key_pos_.push_back(tmp[i].second);
+      }
+
+      list_ = static_cast<const void*>(&arg_list);
+      version_ = arg_list.getVersion();
+      return true;
+    }
+
+    /** Whether the snapshot still matches the passed list's structure
+     * (ie. it was compiled from the list, and no nodes were added,
+     * removed or reordered since). */
+    template <typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+    bool isValid(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_list) const
+    {
+      return (list_ == static_cast<const void*>(&arg_list)) &&
+          (version_ == arg_list.getVersion());
+    }
+
+    /** Whether the snapshot has been compiled (and not cleared) */
+    bool isCompiled() const
+    { return NULL != list_; }
+
+    /** Empties the snapshot */
+    void clear()
+    {
+      data_.clear(); ids_.clear();
+      keys_.clear(); key_pos_.clear();
+      list_ = NULL; version_ = 0;
+    }
+
+    /** Idx based lookup. O(log n). NULL if absent. */
+    const T* at(const Idx& arg_idx) const
+    {
+      const int pos = getIndexNumericAt(arg_idx);
+      if(0 > pos) { return NULL; }
+      return &data_[static_cast<std::size_t>(pos)];
+    }
+
+    /** Position (iteration order) based lookup. O(1). NULL if absent. */
+    const T* at(const std::size_t arg_idx) const
+    {
+      if(arg_idx >= data_.size()) { return NULL; }
+      return &data_[arg_idx];
+    }
+
+    /** The index of the element at a position. NULL if absent. */
+    const Idx* getIndexAt(const std::size_t arg_idx) const
+    {
+      if(arg_idx >= ids_.size()) { return NULL; }
+      return &ids_[arg_idx];
+    }
+
+    /** The position of an element (in iteration order). -1 if absent. */
+    int getIndexNumericAt(const Idx& arg_idx) const
+    {
+      typename std::vector<Idx>::const_iterator it =
+          std::lower_bound(keys_.begin(), keys_.end(), arg_idx);
+      if(it == keys_.end() || arg_idx < *it) { return -1; }
+      return static_cast<int>(key_pos_[it - keys_.begin()]);
+    }
+
+    /** The elements, contiguous and in the list's iteration order */
+    const T* begin() const
+    { return data_.empty() ? NULL : &data_[0]; }
+
+    const T* end() const
+    { return data_.empty() ? NULL : &data_[0] + data_.size(); }
+
+    const T& operator[](const std::size_t arg_idx) const
+    { return data_[arg_idx]; }
+
+    std::size_t size() const
+    { return data_.size(); }
+
+    bool empty() const
+    { return data_.empty(); }
+
+  private:
+    struct SKeyLess
+    {
+      bool operator()(const std::pair<Idx,std::size_t>& a,
+          const std::pair<Idx,std::size_t>& b) const
+      { return a.first < b.first; }
+    };
+
+    /** The elements in iteration order */
+    std::vector<T> data_;
+
+    /** The indices in iteration order */
+    std::vector<Idx> ids_;
+
+    /** The indices in sorted order, and each one's position in data_ */
+    std::vector<Idx> keys_;
+    std::vector<std::size_t> key_pos_;
+
+    /** The list this was compiled from, and its version at the time */
+    const void* list_;
+    std::size_t version_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTFROZEN_HPP_*/
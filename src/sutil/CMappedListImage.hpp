@@ -0,0 +1,599 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListImage.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTIMAGE_HPP_
+#define CMAPPEDLISTIMAGE_HPP_
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedTree.hpp>
+
+//Required for memory mapped files on Linux
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <stdio.h>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+#ifdef DEBUG
+#include <iostream>
+#endif
+
+namespace sutil
+{
+  /** The header at the start of a mapped list image file.
+   *
+   * An image is the header followed by these sections (each starts at
+   * a multiple of 16 bytes; offsets are from the start of the file):
+   * (a) T[n]           : The elements, in list order
+   * (b) Idx[n]         : The indices, in list order
+   * (c) Idx[n]         : The indices, sorted (for binary search)
+   * (d) uint64[n]      : The list position of each sorted index
+   * Tree images also have:
+   * (e) int64[n]       : Each node's parent's position (-1 if none)
+   * (f) uint64[n+1]    : Where each node's children start in (g)
+   * (g) uint64[...]    : The children's positions
+   * Images with std::string indices also have:
+   * (h) char[...]      : The string table. Each string is followed by
+   *                      a NUL. Sections (b) and (c) then hold each
+   *                      index's offset and length in it. */
+  struct SMappedListImageHeader
+  {
+    char magic_[8];
+    std::uint32_t version_;
+    /** 0x01020304 as written by the machine that made the image */
+    std::uint32_t endian_;
+    std::uint64_t n_;
+    std::uint64_t idx_size_;
+    std::uint64_t t_size_;
+    /** The root's position (-1 if the image isn't a tree) */
+    std::int64_t root_;
+    std::uint64_t off_data_;
+    std::uint64_t off_ids_;
+    std::uint64_t off_keys_;
+    std::uint64_t off_key_pos_;
+    std::uint64_t off_parent_;
+    std::uint64_t off_child_begin_;
+    std::uint64_t off_children_;
+    std::uint64_t n_children_;
+    /** How the indices are stored (see SMappedListImageKey::KIND) */
+    std::uint64_t key_kind_;
+    std::uint64_t off_strings_;
+    std::uint64_t n_string_bytes_;
+    std::uint64_t file_size_;
+  };
+
+  /** A std::string index in an image : Where it starts in the string
+   * table, and its length (excluding the NUL that follows it) */
+  struct SMappedListImageString
+  {
+    std::uint64_t off_;
+    std::uint64_t len_;
+  };
+
+  /** How a CMappedListImage stores its Idx. Trivially copyable indices
+   * are copied into the index sections as they are (KIND 0).
+   *
+   * Provides:
+   * (a) stored_type : What the index sections hold for each Idx
+   * (b) pointer     : What CMappedListImage::getIndexAt returns
+   * (c) store(idx, strings) : An Idx's stored_type. May append to the
+   *                   string table.
+   * (d) get(key, strings, nbytes) : A stored key's pointer (NULL if it
+   *                   doesn't lie in the string table)
+   * (e) compare(key, idx, strings, nbytes) : <0, 0 or >0 as the stored
+   *                   key is less than, equal to or greater than idx */
+  template <typename Idx, bool IsTrivial = std::is_trivially_copyable<Idx>::value>
+  struct SMappedListImageKey
+  {
+    static_assert(IsTrivial,
+        "CMappedListImage : Idx must be trivially copyable or a std::string");
+
+    typedef Idx stored_type;
+    typedef const Idx* pointer;
+    static const std::uint64_t KIND = 0;
+
+    static stored_type store(const Idx& arg_idx, std::vector<char>& arg_strings)
+    { return arg_idx; }
+
+    static pointer get(const stored_type& arg_key, const char* arg_strings,
+        const std::uint64_t arg_nbytes)
+    { return &arg_key; }
+
+    static int compare(const stored_type& arg_key, const Idx& arg_idx,
+        const char* arg_strings, const std::uint64_t arg_nbytes)
+    { return (arg_key < arg_idx) ? -1 : ((arg_idx < arg_key) ? 1 : 0); }
+  };
+
+  /** std::string indices are stored in the image's string table (KIND 1).
+   * getIndexAt returns a pointer to the (NUL terminated) string. */
+  template <>
+  struct SMappedListImageKey<std::string,false>
+  {
+    typedef SMappedListImageString stored_type;
+    typedef const char* pointer;
+    static const std::uint64_t KIND = 1;
+
+    static stored_type store(const std::string& arg_idx, std::vector<char>& arg_strings)
+    {
+      stored_type key;
+      key.off_ = arg_strings.size();
+      key.len_ = arg_idx.size();
+      arg_strings.insert(arg_strings.end(), arg_idx.begin(), arg_idx.end());
+      arg_strings.push_back('\0');
+      return key;
+    }
+
+    static pointer get(const stored_type& arg_key, const char* arg_strings,
+        const std::uint64_t arg_nbytes)
+    {
+      if(arg_key.off_ >= arg_nbytes || arg_key.len_ >= arg_nbytes - arg_key.off_ ||
+          '\0' != arg_strings[arg_key.off_ + arg_key.len_])
+      { return NULL; }
+      return arg_strings + arg_key.off_;
+    }
+
+    /** Keys that don't lie in the string table compare as less than
+     * everything (so a damaged image can't be read out of bounds) */
+    static int compare(const stored_type& arg_key, const std::string& arg_idx,
+        const char* arg_strings, const std::uint64_t arg_nbytes)
+    {
+      const char* str = get(arg_key, arg_strings, arg_nbytes);
+      if(NULL == str) { return -1; }
+      const int c = arg_idx.compare(0, arg_idx.size(), str, static_cast<std::size_t>(arg_key.len_));
+      return (0 > c) ? 1 : ((0 < c) ? -1 : 0);
+    }
+  };
+
+  /** A versioned binary image of a CMappedList (or a CMappedTree's
+   * structure) that can be written once and then memory-mapped.
+   *
+   * Opening an image with map() does no per-node allocation or lookup;
+   * the elements are read in place from the mapped file. Idx lookups
+   * are a binary search over the image's sorted index section.
+   *
+   * Usage:
+   *   //Offline
+   *   sutil::CMappedListImage<int,SBody>::write(list, "model.img");
+   *   sutil::CMappedListImage<int,SBody>::writeTree(tree, SGetBody(), "tree.img");
+   *   //At startup
+   *   sutil::CMappedListImage<int,SBody> img;
+   *   if(img.map("tree.img")) { const SBody* b = img.at(42); ... }
+   *
+   * NOTE : T must be trivially copyable (eg. a POD). Idx must be
+   *        trivially copyable or a std::string (see SMappedListImageKey),
+   *        and must support operator <. With std::string indices,
+   *        getIndexAt returns a const char* into the image.
+   *
+   * NOTE 2 : The image is only readable on machines with the same
+   *          byte order and type layouts (the header records both and
+   *          map() rejects mismatches). */
+  template <typename Idx, typename T>
+  class CMappedListImage
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+        "CMappedListImage : T must be trivially copyable");
+
+    typedef SMappedListImageKey<Idx> Key;
+    typedef typename Key::stored_type SKey;
+
+  public:
+    /** The image format version. Bump it whenever the layout changes. */
+    static const std::uint32_t FORMAT_VERSION = 2;
+
+    CMappedListImage() : hdr_(NULL), map_addr_(NULL), map_len_(0) {}
+
+    ~CMappedListImage()
+    { unmap(); }
+
+    /** Writes the list (indices, elements and order) to an image file */
+    template <typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+    static bool write(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_list,
+        const std::string& arg_file)
+    {
+      //Walk the list once (the const positional lookups would each walk it)
+      std::vector<const T*> data; data.reserve(arg_list.size());
+      std::vector<const Idx*> ids; ids.reserve(arg_list.size());
+      typename CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::const_iterator it,ite;
+      for(it = arg_list.begin(), ite = arg_list.end(); it!=ite; ++it)
+      { data.push_back(&(*it)); ids.push_back(&(!it)); }
+      return writeImage(data, ids, NULL, NULL, NULL, -1, arg_file);
+    }
+
+    /** Writes a linked tree's structure to an image file. Each node
+     * is stored as arg_fn(node) (a T), with its parent's and its
+     * children's positions. The tree's TIdx must be this image's Idx.
+     *
+     * Returns false if the tree has no root. */
+    template <typename TNode, typename Alloc, typename Index, typename Stats, typename Rank,
+              typename NodeTable, typename Fn>
+    static bool writeTree(const CMappedTree<Idx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_tree,
+        Fn arg_fn, const std::string& arg_file)
+    {
+      const TNode* root = arg_tree.getRootNodeConst();
+      if(NULL == root) { return false; }
+
+      const std::size_t n = arg_tree.size();
+      std::vector<const TNode*> nodes; nodes.reserve(n);
+      std::vector<const Idx*> ids; ids.reserve(n);
+      std::vector<T> payload; payload.reserve(n);
+      std::vector<const T*> data(n);
+      std::vector<std::int64_t> parents(n, -1);
+      std::vector<std::uint64_t> child_begin(n+1, 0), children;
+
+      //Number the nodes in one walk (the tree's const lookups would each walk it)
+      CMappedListPtrTable<std::size_t> pos; pos.reserve(n);
+      typename CMappedTree<Idx,TNode,Alloc,Index,Stats,Rank,NodeTable>::const_iterator itn,itne;
+      for(itn = arg_tree.begin(), itne = arg_tree.end(); itn!=itne; ++itn)
+      {
+        pos.insert(static_cast<const void*>(&(*itn)), nodes.size());
+        nodes.push_back(&(*itn)); ids.push_back(&(!itn));
+      }
+
+      for(std::size_t i=0; i<n; ++i)
+      {
+        payload.push_back(arg_fn(*nodes[i]));
+        std::size_t p;
+        if(NULL != nodes[i]->parent_addr_)
+        {
+          if(!pos.find(static_cast<const void*>(nodes[i]->parent_addr_), p)) { return false; }
+          parents[i] = static_cast<std::int64_t>(p);
+        }
+
+        child_begin[i] = children.size();
+        typename std::vector<TNode*>::const_iterator it,ite;
+        for(it = nodes[i]->child_addrs_.begin(), ite = nodes[i]->child_addrs_.end(); it!=ite; ++it)
+        {
+          if(!pos.find(static_cast<const void*>(*it), p)) { return false; }
+          children.push_back(static_cast<std::uint64_t>(p));
+        }
+      }
+      child_begin[n] = children.size();
+      for(std::size_t i=0; i<n; ++i) { data[i] = &payload[i]; }
+
+      std::size_t root_pos;
+      if(!pos.find(static_cast<const void*>(root), root_pos)) { return false; }
+      return writeImage(data, ids, &parents, &child_begin, &children,
+          static_cast<std::int64_t>(root_pos), arg_file);
+    }
+
+    /** Memory-maps an image file (read only). Replaces any earlier
+     * image. Returns false if the file isn't a valid image for this
+     * Idx and T. */
+    bool map(const std::string& arg_file)
+    {
+      unmap();
+      int fd = open(arg_file.c_str(), O_RDONLY);
+      if(0 > fd)
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedListImage::map() : Error. Could not open "<<arg_file;
+#endif
+        return false;
+      }
+      struct stat st;
+      if(0 != fstat(fd, &st) || 0 >= st.st_size)
+      { close(fd); return false; }
+
+      void* addr = mmap(NULL, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd); //The mapping stays valid
+      if(MAP_FAILED == addr)
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedListImage::map() : Error. Could not mmap "<<arg_file;
+#endif
+        return false;
+      }
+      if(false == view(addr, static_cast<std::size_t>(st.st_size)))
+      { munmap(addr, static_cast<std::size_t>(st.st_size)); return false; }
+
+      map_addr_ = addr;
+      map_len_ = static_cast<std::size_t>(st.st_size);
+      return true;
+    }
+
+    /** Uses an image that is already in memory (eg. read into a buffer,
+     * or embedded in the executable). The buffer must outlive this object
+     * and must be 16 byte aligned. Doesn't copy anything. */
+    bool view(const void* arg_buf, const std::size_t arg_len)
+    {
+      unmap();
+      if(NULL == arg_buf || arg_len < sizeof(SMappedListImageHeader) ||
+          0 != reinterpret_cast<std::size_t>(arg_buf) % ALIGN)
+      { return false; }
+
+      const SMappedListImageHeader* h = static_cast<const SMappedListImageHeader*>(arg_buf);
+      const std::uint64_t n = h->n_;
+      bool ok = (0 == std::memcmp(h->magic_, "SUTILIMG", 8)) &&
+          (FORMAT_VERSION == h->version_) && (0x01020304 == h->endian_) &&
+          (sizeof(SKey) == h->idx_size_) && (Key::KIND == h->key_kind_) &&
+          (sizeof(T) == h->t_size_) && (arg_len == h->file_size_) && (n < arg_len) &&
+          fits(h->off_data_, n*sizeof(T), arg_len) &&
+          fits(h->off_ids_, n*sizeof(SKey), arg_len) &&
+          fits(h->off_keys_, n*sizeof(SKey), arg_len) &&
+          fits(h->off_key_pos_, n*sizeof(std::uint64_t), arg_len) &&
+          fits(h->off_strings_, h->n_string_bytes_, arg_len);
+      if(ok && 0 <= h->root_)
+      {
+        //Bound the count before multiplying (the product could wrap)
+        ok = (static_cast<std::uint64_t>(h->root_) < n) &&
+            (h->n_children_ <= arg_len / sizeof(std::uint64_t)) &&
+            fits(h->off_parent_, n*sizeof(std::int64_t), arg_len) &&
+            fits(h->off_child_begin_, (n+1)*sizeof(std::uint64_t), arg_len) &&
+            fits(h->off_children_, h->n_children_*sizeof(std::uint64_t), arg_len);
+      }
+      if(false == ok)
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedListImage::view() : Error. Not a valid image (or it was written for other types).";
+#endif
+        return false;
+      }
+
+      const char* base = static_cast<const char*>(arg_buf);
+      hdr_ = h;
+      data_ = reinterpret_cast<const T*>(base + h->off_data_);
+      ids_ = reinterpret_cast<const SKey*>(base + h->off_ids_);
+      keys_ = reinterpret_cast<const SKey*>(base + h->off_keys_);
+      strings_ = base + h->off_strings_;
+      key_pos_ = reinterpret_cast<const std::uint64_t*>(base + h->off_key_pos_);
+      if(0 <= h->root_)
+      {
+        parents_ = reinterpret_cast<const std::int64_t*>(base + h->off_parent_);
+        child_begin_ = reinterpret_cast<const std::uint64_t*>(base + h->off_child_begin_);
+        children_ = reinterpret_cast<const std::uint64_t*>(base + h->off_children_);
+      }
+      else { parents_ = NULL; child_begin_ = NULL; children_ = NULL; }
+      return true;
+    }
+
+    /** Releases the image (and unmaps its file, if it was mapped) */
+    void unmap()
+    {
+      if(NULL != map_addr_) { munmap(map_addr_, map_len_); }
+      map_addr_ = NULL; map_len_ = 0; hdr_ = NULL;
+    }
+
+    /** Whether an image is in use */
+    bool isValid() const
+    { return NULL != hdr_; }
+
+    /** Whether the image holds a tree's structure */
+    bool isTree() const
+    { return NULL != hdr_ && 0 <= hdr_->root_; }
+
+    std::size_t size() const
+    { return NULL == hdr_ ? 0 : static_cast<std::size_t>(hdr_->n_); }
+
+    bool empty() const
+    { return 0 == size(); }
+
+    /** Idx based lookup. O(log n), no allocation. NULL if absent. */
+    const T* at(const Idx& arg_idx) const
+    {
+      const int pos = getIndexNumericAt(arg_idx);
+      if(0 > pos) { return NULL; }
+      return data_ + pos;
+    }
+
+    /** Position (list order) based lookup. O(1). NULL if absent. */
+    const T* at(const std::size_t arg_idx) const
+    {
+      if(arg_idx >= size()) { return NULL; }
+      return data_ + arg_idx;
+    }
+
+    /** The index of the element at a position. NULL if absent.
+     * A const char* for std::string indices (see SMappedListImageKey). */
+    typename Key::pointer getIndexAt(const std::size_t arg_idx) const
+    {
+      if(arg_idx >= size()) { return NULL; }
+      return Key::get(ids_[arg_idx], strings_, hdr_->n_string_bytes_);
+    }
+
+    /** The position of an element (in list order). -1 if absent. */
+    int getIndexNumericAt(const Idx& arg_idx) const
+    {
+      const std::size_t n = size();
+      std::size_t lo = 0, hi = n;
+      while(lo < hi)
+      {
+        const std::size_t mid = lo + (hi - lo)/2;
+        if(0 > Key::compare(keys_[mid], arg_idx, strings_, hdr_->n_string_bytes_)) { lo = mid + 1; }
+        else { hi = mid; }
+      }
+      if(lo == n || 0 != Key::compare(keys_[lo], arg_idx, strings_, hdr_->n_string_bytes_))
+      { return -1; }
+      const std::uint64_t pos = key_pos_[lo];
+      if(pos >= n) { return -1; }
+      return static_cast<int>(pos);
+    }
+
+    /** The elements, contiguous and in list order */
+    const T* begin() const
+    { return NULL == hdr_ ? NULL : data_; }
+
+    const T* end() const
+    { return NULL == hdr_ ? NULL : data_ + size(); }
+
+    /** Tree images : The root's element. NULL if not a tree. */
+    const T* getRootNode() const
+    { return isTree() ? data_ + hdr_->root_ : NULL; }
+
+    /** Tree images : The position of a node's parent. -1 for the root,
+     * for orphans and if the image isn't a tree. */
+    int getParentNumeric(const std::size_t arg_idx) const
+    {
+      if(false == isTree() || arg_idx >= size()) { return -1; }
+      const std::int64_t p = parents_[arg_idx];
+      if(0 > p || static_cast<std::uint64_t>(p) >= hdr_->n_) { return -1; }
+      return static_cast<int>(p);
+    }
+
+    /** Tree images : The number of children a node has */
+    std::size_t getNumChildren(const std::size_t arg_idx) const
+    {
+      if(false == isTree() || arg_idx >= size()) { return 0; }
+      const std::uint64_t b = child_begin_[arg_idx], e = child_begin_[arg_idx+1];
+      if(b > e || e > hdr_->n_children_) { return 0; }
+      return static_cast<std::size_t>(e - b);
+    }
+
+    /** Tree images : The position of a node's i'th child. -1 if absent. */
+    int getChildNumeric(const std::size_t arg_idx, const std::size_t arg_child) const
+    {
+      if(arg_child >= getNumChildren(arg_idx)) { return -1; }
+      const std::uint64_t c = children_[child_begin_[arg_idx] + arg_child];
+      if(c >= hdr_->n_) { return -1; }
+      return static_cast<int>(c);
+    }
+
+  private:
+    /** All sections start at a multiple of this */
+    static const std::size_t ALIGN = 16;
+
+    static std::uint64_t alignUp(const std::uint64_t arg_off)
+    { return (arg_off + ALIGN - 1) / ALIGN * ALIGN; }
+
+    /** Whether a section is aligned and lies inside the image */
+    static bool fits(const std::uint64_t arg_off, const std::uint64_t arg_len,
+        const std::size_t arg_total)
+    {
+      return (0 == arg_off % ALIGN) && (arg_off >= sizeof(SMappedListImageHeader)) &&
+          (arg_off <= arg_total) && (arg_len <= arg_total - arg_off);
+    }
+
+    struct SKeyLess
+    {
+      bool operator()(const std::pair<const Idx*,std::uint64_t>& a,
+          const std::pair<const Idx*,std::uint64_t>& b) const
+      { return *(a.first) < *(b.first); }
+    };
+
+    /** Lays out the sections and writes them to a file */
+    static bool writeImage(const std::vector<const T*>& arg_data,
+        const std::vector<const Idx*>& arg_ids,
+        const std::vector<std::int64_t>* arg_parents,
+        const std::vector<std::uint64_t>* arg_child_begin,
+        const std::vector<std::uint64_t>* arg_children,
+        const int arg_root, const std::string& arg_file)
+    {
+      const std::uint64_t n = arg_data.size();
+      const bool is_tree = (NULL != arg_parents) && (0 <= arg_root);
+
+      SMappedListImageHeader h;
+      std::memset(&h, 0, sizeof(h));
+      std::memcpy(h.magic_, "SUTILIMG", 8);
+      h.version_ = FORMAT_VERSION;
+      h.endian_ = 0x01020304;
+      h.n_ = n;
+      h.idx_size_ = sizeof(SKey);
+      h.key_kind_ = Key::KIND;
+      h.t_size_ = sizeof(T);
+      h.root_ = is_tree ? arg_root : -1;
+      h.off_data_ = alignUp(sizeof(h));
+      h.off_ids_ = alignUp(h.off_data_ + n*sizeof(T));
+      h.off_keys_ = alignUp(h.off_ids_ + n*sizeof(SKey));
+      h.off_key_pos_ = alignUp(h.off_keys_ + n*sizeof(SKey));
+      std::uint64_t end = h.off_key_pos_ + n*sizeof(std::uint64_t);
+      if(is_tree)
+      {
+        h.n_children_ = arg_children->size();
+        h.off_parent_ = alignUp(end);
+        h.off_child_begin_ = alignUp(h.off_parent_ + n*sizeof(std::int64_t));
+        h.off_children_ = alignUp(h.off_child_begin_ + (n+1)*sizeof(std::uint64_t));
+        end = h.off_children_ + h.n_children_*sizeof(std::uint64_t);
+      }
+
+      //The stored indices (std::string ones fill the string table)
+      std::vector<char> strings;
+      std::vector<SKey> stored;
+      stored.reserve(n);
+      for(std::uint64_t i=0; i<n; ++i) { stored.push_back(Key::store(*arg_ids[i], strings)); }
+      h.off_strings_ = alignUp(end);
+      h.n_string_bytes_ = strings.size();
+      end = h.off_strings_ + h.n_string_bytes_;
+      h.file_size_ = alignUp(end);
+
+      std::vector<char> buf(static_cast<std::size_t>(h.file_size_), 0);
+      char* base = &buf[0];
+      std::memcpy(base, &h, sizeof(h));
+      for(std::uint64_t i=0; i<n; ++i)
+      {
+        std::memcpy(base + h.off_data_ + i*sizeof(T), arg_data[i], sizeof(T));
+        std::memcpy(base + h.off_ids_ + i*sizeof(SKey), &stored[i], sizeof(SKey));
+      }
+
+      //The sorted index section
+      std::vector<std::pair<const Idx*,std::uint64_t> > keys;
+      keys.reserve(n);
+      for(std::uint64_t i=0; i<n; ++i) { keys.push_back(std::make_pair(arg_ids[i], i)); }
+      std::sort(keys.begin(), keys.end(), SKeyLess());
+      for(std::uint64_t i=0; i<n; ++i)
+      {
+        std::memcpy(base + h.off_keys_ + i*sizeof(SKey), &stored[keys[i].second], sizeof(SKey));
+        std::memcpy(base + h.off_key_pos_ + i*sizeof(std::uint64_t), &keys[i].second, sizeof(std::uint64_t));
+      }
+
+      if(is_tree && 0 < n)
+      {
+        std::memcpy(base + h.off_parent_, &(*arg_parents)[0], n*sizeof(std::int64_t));
+        std::memcpy(base + h.off_child_begin_, &(*arg_child_begin)[0], (n+1)*sizeof(std::uint64_t));
+        if(0 < h.n_children_)
+        { std::memcpy(base + h.off_children_, &(*arg_children)[0], h.n_children_*sizeof(std::uint64_t)); }
+      }
+      if(0 < h.n_string_bytes_)
+      { std::memcpy(base + h.off_strings_, &strings[0], strings.size()); }
+
+      FILE* fp = fopen(arg_file.c_str(), "wb");
+      if(NULL == fp)
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedListImage::write() : Error. Could not open "<<arg_file;
+#endif
+        return false;
+      }
+      bool ok = (buf.size() == fwrite(base, 1, buf.size(), fp));
+      ok = (0 == fclose(fp)) && ok;
+      return ok;
+    }
+
+    //Not copyable (it may own a mapping)
+    CMappedListImage(const CMappedListImage&);
+    CMappedListImage& operator = (const CMappedListImage&);
+
+    const SMappedListImageHeader* hdr_;
+    const T* data_;
+    const SKey* ids_;
+    const SKey* keys_;
+    /** The string table (std::string indices only) */
+    const char* strings_;
+    const std::uint64_t* key_pos_;
+    const std::int64_t* parents_;
+    const std::uint64_t* child_begin_;
+    const std::uint64_t* children_;
+
+    /** The mapped file (NULL if the image is a caller's buffer) */
+    void* map_addr_;
+    std::size_t map_len_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTIMAGE_HPP_*/
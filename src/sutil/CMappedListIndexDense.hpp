@@ -0,0 +1,151 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListIndexDense.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTINDEXDENSE_HPP_
+#define CMAPPEDLISTINDEXDENSE_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace sutil
+{
+  /** A CMappedList index policy for keys that are small, dense integer
+   * ids (eg. SInternedStrings, or enums). The key is the position in an
+   * array of node pointers, so lookups, inserts and erases are O(1) with
+   * no hashing or key compares.
+   *
+   * The array grows to the largest key inserted (and keeps its memory
+   * when entries are erased or cleared).
+   *
+   * Usage:
+   *   sutil::CMappedList<sutil::SInternedString, SSensor,
+   *     sutil::CMappedListAllocNew<sutil::SInternedString,SSensor>,
+   *     sutil::CMappedListIndexDense<sutil::SInternedString,SSensor> > sensors;
+   *
+   * Idx must convert to a std::size_t with static_cast. Keep the keys
+   * small : a key of 1000000 makes a 1000000 entry array. Negative
+   * (signed) keys are refused. */
+  template <typename Idx, typename T>
+  class CMappedListIndexDense
+  {
+  public:
+    CMappedListIndexDense() : size_(0) {}
+
+    SMLNode<Idx,T>* find(const Idx& arg_idx) const
+    {
+      std::size_t i;
+      if(false == slotOf(arg_idx, i)) { return NULL; }
+      return (i < nodes_.size()) ? nodes_[i] : NULL;
+    }
+
+    bool insert(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    {
+      std::size_t i;
+      if(NULL == arg_node || false == slotOf(arg_idx, i)) { return false; }
+      if(i >= nodes_.size())
+      { nodes_.resize(i+1, static_cast<SMLNode<Idx,T>*>(NULL)); }
+      if(NULL != nodes_[i]) { return false; }
+      nodes_[i] = arg_node;
+      size_++;
+      return true;
+    }
+
+    /** Order doesn't help an array. Same as insert. */
+    bool insertHinted(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    { return insert(arg_idx, arg_node); }
+
+    bool erase(const Idx& arg_idx)
+    {
+      std::size_t i;
+      if(false == slotOf(arg_idx, i)) { return false; }
+      if(i >= nodes_.size() || NULL == nodes_[i]) { return false; }
+      nodes_[i] = NULL;
+      size_--;
+      return true;
+    }
+
+    /** Removes all the entries (but keeps the array's memory) */
+    void clear()
+    {
+      std::fill(nodes_.begin(), nodes_.end(), static_cast<SMLNode<Idx,T>*>(NULL));
+      size_ = 0;
+    }
+
+    std::size_t size() const
+    { return size_; }
+
+    /** Makes room for keys up to n-1 without growing the array */
+    void reserve(const std::size_t arg_n)
+    { nodes_.reserve(arg_n); }
+
+    void swap(CMappedListIndexDense<Idx,T>& arg_swap_obj)
+    {
+      nodes_.swap(arg_swap_obj.nodes_);
+      std::swap(size_, arg_swap_obj.size_);
+    }
+
+    /** Copies the passed array and points each entry at remap(node).
+     * Returns false (and leaves the index empty) if a node can't be
+     * remapped. */
+    template <typename Remap>
+    bool cloneFrom(const CMappedListIndexDense<Idx,T>& arg_src, const Remap& arg_remap)
+    {
+      nodes_ = arg_src.nodes_;
+      size_ = arg_src.size_;
+      typename std::vector<SMLNode<Idx,T>*>::iterator it,ite;
+      for(it = nodes_.begin(), ite = nodes_.end(); it!=ite; ++it)
+      {
+        if(NULL == *it) { continue; }
+        *it = arg_remap(*it);
+        if(NULL == *it) { clear(); return false; }
+      }
+      return true;
+    }
+
+  private:
+    /** Enums are checked as their underlying integer type */
+    template <typename I, bool E = std::is_enum<I>::value>
+    struct SKeyRep { typedef I type; };
+    template <typename I>
+    struct SKeyRep<I,true> { typedef typename std::underlying_type<I>::type type; };
+
+    /** Signed keys below zero have no slot (casting them would ask for
+     * an array of about 2^64 entries). Others can't be negative. */
+    template <typename I>
+    static bool negative(const I& arg_idx, std::true_type)
+    { return static_cast<typename SKeyRep<I>::type>(arg_idx) < 0; }
+    template <typename I>
+    static bool negative(const I& arg_idx, std::false_type)
+    { return false; }
+
+    /** The key's position in the array. False for negative keys. */
+    static bool slotOf(const Idx& arg_idx, std::size_t& ret_i)
+    {
+      if(negative(arg_idx, std::integral_constant<bool,
+          std::is_signed<typename SKeyRep<Idx>::type>::value>()))
+      { return false; }
+      ret_i = static_cast<std::size_t>(arg_idx);
+      return true;
+    }
+
+    /** The node for each key (NULL if the key isn't in the list) */
+    std::vector<SMLNode<Idx,T>*> nodes_;
+    /** The number of entries */
+    std::size_t size_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTINDEXDENSE_HPP_*/
@@ -0,0 +1,207 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListIndexHash.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTINDEXHASH_HPP_
+#define CMAPPEDLISTINDEXHASH_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstddef>
+
+namespace sutil
+{
+  /** A CMappedList index policy that looks up nodes in an
+   * open-addressing hash table (linear probing). Lookups, inserts
+   * and erases are O(1) on average.
+   *
+   * Each slot caches its key's hash, so a probe only compares keys
+   * (eg. strings) when the hashes match. Keys aren't duplicated; the
+   * table compares against the node's id_.
+   *
+   * The table doubles when it is 3/4 full, and erases shift later
+   * entries back (no tombstones), so lookups don't slow down after
+   * many create/erase cycles.
+   *
+   * Usage:
+   *   sutil::CMappedList<std::string, double,
+   *     sutil::CMappedListAllocNew<std::string,double>,
+   *     sutil::CMappedListIndexHash<std::string,double> > list;
+   *
+   * Hash must be a functor with : std::size_t operator()(const Idx&) const
+   * (std::hash<Idx> by default). Idx must support operator ==. */
+  template <typename Idx, typename T, typename Hash = std::hash<Idx> >
+  class CMappedListIndexHash
+  {
+  public:
+    CMappedListIndexHash() : mask_(0), size_(0) {}
+
+    SMLNode<Idx,T>* find(const Idx& arg_idx) const
+    {
+      if(0 == size_) { return NULL; }
+      const std::size_t h = hashOf(arg_idx);
+      for(std::size_t i = h & mask_; ; i = (i+1) & mask_)
+      {
+        const SSlot& s = slots_[i];
+        if(NULL == s.node_) { return NULL; }
+        if(s.hash_ == h && *(s.node_->id_) == arg_idx)
+        { return s.node_; }
+      }
+    }
+
+    bool insert(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    {
+      if(NULL == arg_node) { return false; }
+      if((size_+1)*4 > slots_.size()*3)
+      { rehash(slots_.size() < 16 ? 16 : slots_.size()*2); }
+
+      const std::size_t h = hashOf(arg_idx);
+      std::size_t i = h & mask_;
+      for(; NULL != slots_[i].node_; i = (i+1) & mask_)
+      {
+        if(slots_[i].hash_ == h && *(slots_[i].node_->id_) == arg_idx)
+        { return false; }
+      }
+      slots_[i].hash_ = h;
+      slots_[i].node_ = arg_node;
+      size_++;
+      return true;
+    }
+
+    /** Order doesn't help a hash table. Same as insert. */
+    bool insertHinted(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    { return insert(arg_idx, arg_node); }
+
+    bool erase(const Idx& arg_idx)
+    {
+      if(0 == size_) { return false; }
+      const std::size_t h = hashOf(arg_idx);
+      std::size_t i = h & mask_;
+      for(; ; i = (i+1) & mask_)
+      {
+        if(NULL == slots_[i].node_) { return false; }
+        if(slots_[i].hash_ == h && *(slots_[i].node_->id_) == arg_idx)
+        { break; }
+      }
+
+      //Shift later entries in the probe sequence back into the hole,
+      //unless that would move them before their home slot.
+      for(std::size_t j = (i+1) & mask_; NULL != slots_[j].node_; j = (j+1) & mask_)
+      {
+        std::size_t home = slots_[j].hash_ & mask_;
+        bool can_move = (i <= j) ? (home <= i || home > j) : (home <= i && home > j);
+        if(can_move)
+        { slots_[i] = slots_[j]; i = j; }
+      }
+      slots_[i].node_ = NULL;
+      size_--;
+      return true;
+    }
+
+    /** Removes all the entries (but keeps the table's memory) */
+    void clear()
+    {
+      typename std::vector<SSlot>::iterator it,ite;
+      for(it = slots_.begin(), ite = slots_.end(); it!=ite; ++it)
+      { it->node_ = NULL; }
+      size_ = 0;
+    }
+
+    std::size_t size() const
+    { return size_; }
+
+    /** Grows the table so that n entries fit without a rehash */
+    void reserve(const std::size_t arg_n)
+    {
+      std::size_t cap = slots_.size() < 16 ? 16 : slots_.size();
+      while(arg_n*4 > cap*3) { cap *= 2; }
+      if(cap > slots_.size()) { rehash(cap); }
+    }
+
+    void swap(CMappedListIndexHash<Idx,T,Hash>& arg_swap_obj)
+    {
+      slots_.swap(arg_swap_obj.slots_);
+      std::swap(mask_, arg_swap_obj.mask_);
+      std::swap(size_, arg_swap_obj.size_);
+      std::swap(hash_fn_, arg_swap_obj.hash_fn_);
+    }
+
+    /** Copies the passed table slot for slot (no rehashing or key
+     * compares) and points each entry at remap(node). Returns false
+     * (and leaves the index empty) if a node can't be remapped. */
+    template <typename Remap>
+    bool cloneFrom(const CMappedListIndexHash<Idx,T,Hash>& arg_src, const Remap& arg_remap)
+    {
+      slots_ = arg_src.slots_;
+      mask_ = arg_src.mask_;
+      size_ = arg_src.size_;
+      hash_fn_ = arg_src.hash_fn_;
+      typename std::vector<SSlot>::iterator it,ite;
+      for(it = slots_.begin(), ite = slots_.end(); it!=ite; ++it)
+      {
+        if(NULL == it->node_) { continue; }
+        it->node_ = arg_remap(it->node_);
+        if(NULL == it->node_) { clear(); return false; }
+      }
+      return true;
+    }
+
+    /** The number of slots in the table */
+    std::size_t getCapacity() const
+    { return slots_.size(); }
+
+  private:
+    struct SSlot
+    {
+      std::size_t hash_;
+      SMLNode<Idx,T>* node_;
+      SSlot() : hash_(0), node_(NULL) {}
+    };
+
+    /** Mixes the user's hash so that poor hashes (eg. std::hash
+     * on integers is the identity) spread over the low bits. */
+    std::size_t hashOf(const Idx& arg_idx) const
+    {
+      unsigned long long h = static_cast<unsigned long long>(hash_fn_(arg_idx));
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      return static_cast<std::size_t>(h);
+    }
+
+    /** Moves all the entries into a table with arg_cap (a power of 2) slots */
+    void rehash(const std::size_t arg_cap)
+    {
+      std::vector<SSlot> old(arg_cap);
+      old.swap(slots_);
+      mask_ = arg_cap - 1;
+
+      typename std::vector<SSlot>::const_iterator it,ite;
+      for(it = old.begin(), ite = old.end(); it!=ite; ++it)
+      {
+        if(NULL == it->node_) { continue; }
+        std::size_t i = it->hash_ & mask_;
+        while(NULL != slots_[i].node_) { i = (i+1) & mask_; }
+        slots_[i] = *it;
+      }
+    }
+
+    std::vector<SSlot> slots_;
+    std::size_t mask_;
+    std::size_t size_;
+    Hash hash_fn_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTINDEXHASH_HPP_*/
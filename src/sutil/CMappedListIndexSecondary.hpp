@@ -0,0 +1,262 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListIndexSecondary.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTINDEXSECONDARY_HPP_
+#define CMAPPEDLISTINDEXSECONDARY_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <unordered_map>
+#include <map>
+#include <utility>
+#include <cstddef>
+
+namespace sutil
+{
+  /** Reads a member of T, for use as a CMappedListIndexSecondary's Extract.
+   *
+   * Usage:
+   *   sutil::CMappedListExtractMember<SLink, int, &SLink::joint_id_>
+   *
+   * NOTE : The member must be declared in T (not in a base class, like
+   *        a tree node's name_). Write a functor for those. */
+  template <typename T, typename K, K T::*Member>
+  struct CMappedListExtractMember
+  {
+    typedef K key_type;
+    const K& operator()(const T& arg_t) const
+    { return arg_t.*Member; }
+  };
+
+  /** A CMappedList index policy that adds a secondary index (eg. by a
+   * joint id, a type tag or a parent name) to another (Primary) index.
+   * Lookups by Idx go to the Primary index. Creating, inserting, erasing
+   * and clearing keep both up to date.
+   *
+   * Extract reads an element's secondary key. It must be a functor with
+   * a key_type typedef and : key_type operator()(const T&) const.
+   *
+   * Map holds the secondary keys. Pick it for the queries you need :
+   * (a) std::unordered_multimap (default) : O(1) lookups, repeats allowed
+   * (b) std::unordered_map : O(1) lookups, each key once
+   * (c) std::multimap : O(log n) lookups, key ordered ranges, repeats allowed
+   * (d) std::map : O(log n) lookups, key ordered ranges, each key once
+   * A unique Map refuses elements whose key is taken, so the list's
+   * create() and insert() return NULL for them.
+   *
+   * Secondary indices nest (pass one as another's Primary) to index
+   * more than one key.
+   *
+   * Usage:
+   *   typedef sutil::CMappedListIndexSecondary<std::string, SLink,
+   *     sutil::CMappedListExtractMember<SLink,int,&SLink::joint_id_>,
+   *     sutil::CMappedListIndexMap<std::string,SLink>,
+   *     std::unordered_map<int, sutil::SMLNode<std::string,SLink>*> > TJointIdx;
+   *   sutil::CMappedTree<std::string, SLink,
+   *     sutil::CMappedListAllocNew<std::string,SLink>, TJointIdx> robot;
+   *   ...
+   *   SLink* l = robot.getIndex().findBy(7); //O(1)
+   *
+   * NOTE : The index reads the key when an element is added. If you
+   *        change the field later, call the list's reindex(element).
+   *        The queries return non-const elements (like the list's at()),
+   *        since the list only exposes a const index. */
+  template <typename Idx, typename T, typename Extract,
+            typename Primary = CMappedListIndexMap<Idx,T>,
+            typename Map = std::unordered_multimap<typename Extract::key_type, SMLNode<Idx,T>*> >
+  class CMappedListIndexSecondary
+  {
+  public:
+    typedef typename Extract::key_type key_type;
+
+    /** Iterates over the elements with a secondary key (see rangeBy) */
+    typedef CMappedListKeyIterator<Idx,T,T,typename Map::const_iterator> iterator;
+
+    SMLNode<Idx,T>* find(const Idx& arg_idx) const
+    { return primary_.find(arg_idx); }
+
+    bool insert(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    {
+      if(NULL == arg_node || false == primary_.insert(arg_idx, arg_node))
+      { return false; }
+      if(false == add(arg_node, extract_(*(arg_node->data_))))
+      { primary_.erase(arg_idx); return false; }
+      return true;
+    }
+
+    bool insertHinted(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    {
+      if(NULL == arg_node || false == primary_.insertHinted(arg_idx, arg_node))
+      { return false; }
+      if(false == add(arg_node, extract_(*(arg_node->data_))))
+      { primary_.erase(arg_idx); return false; }
+      return true;
+    }
+
+    bool erase(const Idx& arg_idx)
+    {
+      SMLNode<Idx,T>* node = primary_.find(arg_idx);
+      if(NULL == node) { return false; }
+      remove(node);
+      return primary_.erase(arg_idx);
+    }
+
+    void clear()
+    { primary_.clear(); map_.clear(); keys_.clear(); }
+
+    std::size_t size() const
+    { return primary_.size(); }
+
+    void reserve(const std::size_t arg_n)
+    {
+      primary_.reserve(arg_n);
+      reserveMap(map_, arg_n, 0);
+      keys_.reserve(arg_n);
+    }
+
+    void swap(CMappedListIndexSecondary<Idx,T,Extract,Primary,Map>& arg_swap_obj)
+    {
+      primary_.swap(arg_swap_obj.primary_);
+      map_.swap(arg_swap_obj.map_);
+      keys_.swap(arg_swap_obj.keys_);
+      std::swap(extract_, arg_swap_obj.extract_);
+    }
+
+    /** Copies the passed index (without re-extracting or hashing any
+     * keys) and points each entry at remap(node). Returns false (and
+     * leaves the index empty) if a node can't be remapped. */
+    template <typename Remap>
+    bool cloneFrom(const CMappedListIndexSecondary<Idx,T,Extract,Primary,Map>& arg_src,
+        const Remap& arg_remap)
+    {
+      clear();
+      if(false == primary_.cloneFrom(arg_src.primary_, arg_remap))
+      { return false; }
+      map_ = arg_src.map_;
+      extract_ = arg_src.extract_;
+      keys_.reserve(arg_src.primary_.size());
+      typename Map::iterator it,ite;
+      for(it = map_.begin(), ite = map_.end(); it!=ite; ++it)
+      {
+        it->second = arg_remap(it->second);
+        if(NULL == it->second) { clear(); return false; }
+        keys_.insert(static_cast<const void*>(it->second), it->first);
+      }
+      return true;
+    }
+
+    /** Re-reads a node's secondary key (after its field changed). If the
+     * new key is refused (a unique Map), keeps the old one and returns
+     * false. Also reindexes a nested secondary Primary. */
+    bool reindex(SMLNode<Idx,T>* arg_node)
+    {
+      key_type old_key;
+      if(false == keys_.find(static_cast<const void*>(arg_node), old_key))
+      { return false; }
+      remove(arg_node);
+      if(false == add(arg_node, extract_(*(arg_node->data_))))
+      { add(arg_node, old_key); return false; }
+      return reindexPrimary(primary_, arg_node, 0);
+    }
+
+    /** An element with the secondary key (NULL if there is none) */
+    T* findBy(const key_type& arg_key) const
+    {
+      typename Map::const_iterator it = map_.find(arg_key);
+      return (it == map_.end()) ? NULL : it->second->data_;
+    }
+
+    /** The number of elements with the secondary key */
+    std::size_t countBy(const key_type& arg_key) const
+    { return map_.count(arg_key); }
+
+    /** The elements with the secondary key. !it is an element's Idx.
+     *
+     * Usage:
+     *   std::pair<TIdx::iterator, TIdx::iterator> r =
+     *       robot.getIndex().rangeBy("torso"); //eg. by parent name
+     *   for(; r.first != r.second; ++r.first) { r.first->... } */
+    std::pair<iterator,iterator> rangeBy(const key_type& arg_key) const
+    {
+      std::pair<typename Map::const_iterator, typename Map::const_iterator> r =
+          map_.equal_range(arg_key);
+      return std::make_pair(iterator(r.first), iterator(r.second));
+    }
+
+    /** All the secondary keys and their nodes (eg. to iterate over the
+     * keys in order with a std::multimap) */
+    const Map& getMap() const
+    { return map_; }
+
+    /** The index that finds elements by Idx */
+    const Primary& getPrimary() const
+    { return primary_; }
+
+  private:
+    /** Adds a node to the secondary map and remembers its key */
+    bool add(SMLNode<Idx,T>* arg_node, const key_type& arg_key)
+    {
+      if(false == inserted(map_.insert(std::make_pair(arg_key, arg_node))))
+      { return false; }
+      keys_.insert(static_cast<const void*>(arg_node), arg_key);
+      return true;
+    }
+
+    /** Removes a node from the secondary map (under the key it was
+     * added with, even if its field has since changed) */
+    void remove(SMLNode<Idx,T>* arg_node)
+    {
+      key_type key;
+      if(false == keys_.find(static_cast<const void*>(arg_node), key))
+      { return; }
+      keys_.erase(static_cast<const void*>(arg_node));
+      std::pair<typename Map::iterator, typename Map::iterator> r = map_.equal_range(key);
+      for(; r.first != r.second; ++r.first)
+      { if(r.first->second == arg_node) { map_.erase(r.first); return; } }
+    }
+
+    /** Unique maps return <iterator,bool>. Multi maps always insert. */
+    template <typename It>
+    static bool inserted(const std::pair<It,bool>& arg_ret)
+    { return arg_ret.second; }
+    template <typename It>
+    static bool inserted(const It& arg_ret)
+    { return true; }
+
+    /** Hashed maps can preallocate. Ordered ones can't. */
+    template <typename M>
+    static auto reserveMap(M& arg_map, const std::size_t arg_n, int) -> decltype(arg_map.reserve(arg_n), void())
+    { arg_map.reserve(arg_n); }
+    template <typename M>
+    static void reserveMap(M& arg_map, const std::size_t arg_n, long) {}
+
+    /** Nested secondary indices reindex too. Others have nothing to do. */
+    template <typename P>
+    static auto reindexPrimary(P& arg_p, SMLNode<Idx,T>* arg_node, int) -> decltype(arg_p.reindex(arg_node))
+    { return arg_p.reindex(arg_node); }
+    template <typename P>
+    static bool reindexPrimary(P& arg_p, SMLNode<Idx,T>* arg_node, long)
+    { return true; }
+
+    /** Finds nodes by Idx */
+    Primary primary_;
+    /** Finds nodes by secondary key */
+    Map map_;
+    /** The key each node was added under (so that erases and reindexes
+     * find its entry after the field changes) */
+    CMappedListPtrTable<key_type> keys_;
+    /** Reads the secondary keys */
+    Extract extract_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTINDEXSECONDARY_HPP_*/
@@ -0,0 +1,235 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListIndexSmall.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTINDEXSMALL_HPP_
+#define CMAPPEDLISTINDEXSMALL_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace sutil
+{
+  /** Finds keys in a CMappedListIndexSmall's inline array. Compares
+   * each node's id_ (for keys that aren't integers, eg. strings). */
+  template <typename Idx, typename T, std::size_t N,
+            bool Integral = std::is_integral<Idx>::value>
+  class CMappedListSmallKeys
+  {
+  public:
+    void set(const std::size_t arg_i, const Idx& arg_idx) {}
+
+    int find(const Idx& arg_idx, SMLNode<Idx,T>* const * arg_nodes,
+        const std::size_t arg_n) const
+    {
+      for(std::size_t i=0; i<arg_n; ++i)
+      { if(*(arg_nodes[i]->id_) == arg_idx) { return static_cast<int>(i); } }
+      return -1;
+    }
+  };
+
+  /** Integer keys are copied into a contiguous (padded) array and
+   * compared four at a time with SSE2 (for 32 bit keys), else with a
+   * plain loop that doesn't touch the nodes. */
+  template <typename Idx, typename T, std::size_t N>
+  class CMappedListSmallKeys<Idx,T,N,true>
+  {
+  public:
+    CMappedListSmallKeys()
+    { std::fill(keys_, keys_+NPad, Idx()); }
+
+    void set(const std::size_t arg_i, const Idx& arg_idx)
+    { keys_[arg_i] = arg_idx; }
+
+    int find(const Idx& arg_idx, SMLNode<Idx,T>* const * arg_nodes,
+        const std::size_t arg_n) const
+    {
+#ifdef __SSE2__
+      if(4 == sizeof(Idx))
+      {
+        const __m128i k = _mm_set1_epi32(static_cast<int>(arg_idx));
+        for(std::size_t i=0; i<arg_n; i+=4)
+        {
+          __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys_+i));
+          int m = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v,k)));
+          if(i+4 > arg_n) { m &= (1<<(arg_n-i)) - 1; } //Ignore the unused slots
+          if(0 != m) { return static_cast<int>(i) + __builtin_ctz(m); }
+        }
+        return -1;
+      }
+#endif
+      for(std::size_t i=0; i<arg_n; ++i)
+      { if(keys_[i] == arg_idx) { return static_cast<int>(i); } }
+      return -1;
+    }
+
+  private:
+    /** N rounded up to a multiple of 4 (so SSE loads stay inside) */
+    static const std::size_t NPad = ((N+3)/4)*4;
+    Idx keys_[NPad];
+  };
+
+  /** A CMappedList index policy for lists that are usually small
+   * (eg. a link's sensors, or a task's callbacks).
+   *
+   * Up to N entries live in an inline array and are searched linearly,
+   * which beats a std::map (and its heap nodes) for a handful of keys.
+   * Integer keys are compared with SSE2 where available.
+   *
+   * Inserting entry N+1 moves all the entries into a Big index (a
+   * std::map by default), which is used from then on. The index goes
+   * back to the inline array only when it is cleared. If the Big index
+   * refuses entries (a CMappedListIndexNone), inserts past N fail.
+   *
+   * Usage:
+   *   sutil::CMappedList<int, SSensor, sutil::CMappedListAllocNew<int,SSensor>,
+   *     sutil::CMappedListIndexSmall<int,SSensor,16> > sensors;
+   *
+   * Idx must support operator ==. */
+  template <typename Idx, typename T, std::size_t N = 16,
+            typename Big = CMappedListIndexMap<Idx,T> >
+  class CMappedListIndexSmall
+  {
+  public:
+    CMappedListIndexSmall() : size_(0), flag_big_(false)
+    { std::fill(nodes_, nodes_+N, static_cast<SMLNode<Idx,T>*>(NULL)); }
+
+    SMLNode<Idx,T>* find(const Idx& arg_idx) const
+    {
+      if(flag_big_) { return big_.find(arg_idx); }
+      const int i = keys_.find(arg_idx, nodes_, size_);
+      return (0 > i) ? NULL : nodes_[i];
+    }
+
+    bool insert(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    {
+      if(flag_big_) { return big_.insert(arg_idx, arg_node); }
+      if(NULL == arg_node || 0 <= keys_.find(arg_idx, nodes_, size_))
+      { return false; }
+      if(N == size_)
+      {
+        if(false == toBig()) { return false; }
+        return big_.insert(arg_idx, arg_node);
+      }
+      nodes_[size_] = arg_node;
+      keys_.set(size_, arg_idx);
+      size_++;
+      return true;
+    }
+
+    /** Order doesn't help a linear search. Same as insert. */
+    bool insertHinted(const Idx& arg_idx, SMLNode<Idx,T>* arg_node)
+    {
+      if(flag_big_) { return big_.insertHinted(arg_idx, arg_node); }
+      return insert(arg_idx, arg_node);
+    }
+
+    /** Moves the last entry into the erased one's slot */
+    bool erase(const Idx& arg_idx)
+    {
+      if(flag_big_) { return big_.erase(arg_idx); }
+      const int i = keys_.find(arg_idx, nodes_, size_);
+      if(0 > i) { return false; }
+      size_--;
+      nodes_[i] = nodes_[size_];
+      keys_.set(i, *(nodes_[size_]->id_));
+      nodes_[size_] = NULL;
+      return true;
+    }
+
+    /** Removes all the entries and goes back to the inline array */
+    void clear()
+    {
+      big_.clear();
+      flag_big_ = false;
+      std::fill(nodes_, nodes_+size_, static_cast<SMLNode<Idx,T>*>(NULL));
+      size_ = 0;
+    }
+
+    std::size_t size() const
+    { return flag_big_ ? big_.size() : size_; }
+
+    /** Reserves the Big index (if the entries have moved to it). The
+     * inline array needs nothing. */
+    void reserve(const std::size_t arg_n)
+    { if(flag_big_) { big_.reserve(arg_n); } }
+
+    /** O(N) : Swaps the inline arrays, and the Big indices */
+    void swap(CMappedListIndexSmall<Idx,T,N,Big>& arg_swap_obj)
+    {
+      std::swap(nodes_, arg_swap_obj.nodes_);
+      std::swap(keys_, arg_swap_obj.keys_);
+      std::swap(size_, arg_swap_obj.size_);
+      std::swap(flag_big_, arg_swap_obj.flag_big_);
+      big_.swap(arg_swap_obj.big_);
+    }
+
+    /** Copies the passed index (inline array or Big index) and points
+     * each entry at remap(node). Returns false (and leaves the index
+     * empty) if a node can't be remapped. */
+    template <typename Remap>
+    bool cloneFrom(const CMappedListIndexSmall<Idx,T,N,Big>& arg_src, const Remap& arg_remap)
+    {
+      clear();
+      if(arg_src.flag_big_)
+      {
+        flag_big_ = true;
+        if(big_.cloneFrom(arg_src.big_, arg_remap)) { return true; }
+        clear(); return false;
+      }
+      keys_ = arg_src.keys_;
+      for(std::size_t i=0; i<arg_src.size_; ++i)
+      {
+        nodes_[i] = arg_remap(arg_src.nodes_[i]);
+        if(NULL == nodes_[i]) { clear(); return false; }
+        size_++;
+      }
+      return true;
+    }
+
+    /** Whether the entries have moved to the Big index */
+    bool isBig() const
+    { return flag_big_; }
+
+  private:
+    /** Moves the inline entries into the Big index. Returns false (and
+     * keeps the entries inline) if the Big index refuses them (eg. a
+     * CMappedListIndexNone, for fixed-capacity lists). */
+    bool toBig()
+    {
+      big_.clear();
+      for(std::size_t i=0; i<size_; ++i)
+      {
+        if(false == big_.insert(*(nodes_[i]->id_), nodes_[i]))
+        { big_.clear(); return false; }
+      }
+      std::fill(nodes_, nodes_+size_, static_cast<SMLNode<Idx,T>*>(NULL));
+      size_ = 0;
+      flag_big_ = true;
+      return true;
+    }
+
+    SMLNode<Idx,T>* nodes_[N];
+    CMappedListSmallKeys<Idx,T,N> keys_;
+    std::size_t size_;
+    bool flag_big_;
+    Big big_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTINDEXSMALL_HPP_*/
@@ -0,0 +1,111 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListParallel.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTPARALLEL_HPP_
+#define CMAPPEDLISTPARALLEL_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <vector>
+#include <cstddef>
+
+namespace sutil
+{
+  /** Calls arg_fn(T&) on every element of a mapped list (or a mapped
+   * tree, graph or multi-level list) across OpenMP threads.
+   *
+   * A linked list can't be split without a walk, so this first copies
+   * the element pointers into an array (one O(n) serial pass, which
+   * reuses the list's position cache if it is valid). The array is then
+   * handed out to the threads in chunks of arg_grain elements.
+   *
+   * Usage:
+   *   struct SUpdate { void operator()(SMyNode& n) const {...} };
+   *   sutil::parallel_for_each(tree, SUpdate());
+   *
+   * NOTE : arg_fn is shared by all the threads. It must be safe to call
+   *        concurrently on different elements, and it must not throw.
+   *        It must not add, remove or reorder the list's nodes.
+   *
+   * NOTE 2 : Runs serially if the code isn't compiled with OpenMP
+   *          (-fopenmp), or if the list fits in one chunk. */
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable, typename Fn>
+  void parallel_for_each(CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_list, Fn arg_fn,
+      const std::size_t arg_grain = 1024)
+  {
+    const std::size_t grain = (0 == arg_grain) ? 1 : arg_grain;
+    std::vector<T*> ptrs;
+    arg_list.getElementPointers(ptrs);
+    const std::size_t n = ptrs.size();
+    const long nchunks = static_cast<long>((n + grain - 1) / grain);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1) if(nchunks > 1)
+#endif
+    for(long c=0; c<nchunks; ++c)
+    {
+      const std::size_t i0 = static_cast<std::size_t>(c)*grain;
+      const std::size_t i1 = (i0 + grain < n) ? i0 + grain : n;
+      for(std::size_t i=i0; i<i1; ++i)
+      { arg_fn(*ptrs[i]); }
+    }
+  }
+
+  /** Maps every element of a mapped list (or a mapped tree, graph or
+   * multi-level list) to a value with arg_map(const T&), and combines
+   * the values with arg_reduce(R,R), across OpenMP threads.
+   *
+   * Each chunk of arg_grain elements is reduced (in list order) to a
+   * partial result. The partials are then combined in chunk order,
+   * starting from arg_init. So the result doesn't depend on the number
+   * of threads (which matters for floating point sums), but arg_reduce
+   * should be associative.
+   *
+   * Usage:
+   *   double mass = sutil::parallel_reduce(tree, 0.0, SGetMass(), std::plus<double>());
+   *
+   * NOTE : The same thread-safety rules as parallel_for_each apply
+   *        to arg_map and arg_reduce. */
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable,
+    typename R, typename MapFn, typename ReduceFn>
+  R parallel_reduce(const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_list, const R& arg_init,
+      MapFn arg_map, ReduceFn arg_reduce, const std::size_t arg_grain = 1024)
+  {
+    const std::size_t grain = (0 == arg_grain) ? 1 : arg_grain;
+    std::vector<const T*> ptrs;
+    arg_list.getElementPointers(ptrs);
+    const std::size_t n = ptrs.size();
+    const long nchunks = static_cast<long>((n + grain - 1) / grain);
+
+    std::vector<R> partials(static_cast<std::size_t>(nchunks), arg_init);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1) if(nchunks > 1)
+#endif
+    for(long c=0; c<nchunks; ++c)
+    {
+      const std::size_t i0 = static_cast<std::size_t>(c)*grain;
+      const std::size_t i1 = (i0 + grain < n) ? i0 + grain : n;
+      R part = arg_map(*ptrs[i0]);
+      for(std::size_t i=i0+1; i<i1; ++i)
+      { part = arg_reduce(part, arg_map(*ptrs[i])); }
+      partials[static_cast<std::size_t>(c)] = part;
+    }
+
+    R ret = arg_init;
+    for(long c=0; c<nchunks; ++c)
+    { ret = arg_reduce(ret, partials[static_cast<std::size_t>(c)]); }
+    return ret;
+  }
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTPARALLEL_HPP_*/
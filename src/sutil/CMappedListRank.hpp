@@ -0,0 +1,192 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListRank.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTRANK_HPP_
+#define CMAPPEDLISTRANK_HPP_
+
+#include <sutil/CMappedList.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sutil
+{
+  /** A CMappedList rank policy that finds positions in O(log n), and
+   * keeps doing so while nodes are created and erased.
+   *
+   * A list only links nodes at its front or back, so each node gets a
+   * slot in an array, in list order: front inserts take the slot before
+   * the first one, back inserts the slot after the last one. Erased
+   * nodes leave holes. A Fenwick (binary indexed) tree counts the live
+   * slots, so a node's position (the live slots before it) and the node
+   * at a position (a descent through the tree) are O(log n).
+   *
+   * The array is rebuilt (O(n)) when an end runs out of slots, when
+   * more than half the slots are holes, and when the list is reordered.
+   * Each rebuild leaves n/2 free slots at each end, so creates and
+   * erases stay amortized O(log n).
+   *
+   * Usage:
+   *   sutil::CMappedList<int, SRecord, sutil::CMappedListAllocNew<int,SRecord>,
+   *     sutil::CMappedListIndexMap<int,SRecord>, sutil::CMappedListStatsNone,
+   *     sutil::CMappedListRankFenwick<int,SRecord> > records;
+   *   SRecord* r = records.at(static_cast<std::size_t>(50000)); //O(log n)
+   *   it = records.begin() + 50000; //O(log n), random access
+   *
+   * To find a pointer's position (getIndexNumericAt(const T*)) in
+   * O(log n) too, also pass a CMappedListNodeTableHash as the list's
+   * NodeTable argument. Without one, the node is found by a walk.
+   *
+   * NOTE : Uses about 3 words per node (the slot, its count and the
+   *        node's entry in a pointer table). */
+  template <typename Idx, typename T>
+  class CMappedListRankFenwick
+  {
+  public:
+    static const bool Indexed = true;
+
+    CMappedListRankFenwick() : lo_(0), hi_(0), live_(0), top_(0) {}
+
+    /** Gives the node the slot before the first (or after the last) */
+    void onLink(SMLNode<Idx,T>* arg_node, const bool arg_at_start,
+        SMLNode<Idx,T>* arg_front, const std::size_t arg_size)
+    {
+      if(arg_at_start ? (0 == lo_) : (slots_.size() == hi_))
+      { rebuild(arg_front, arg_size); return; }
+      const std::size_t s = arg_at_start ? --lo_ : hi_++;
+      slots_[s] = arg_node;
+      slot_of_.insert(static_cast<const void*>(arg_node), s);
+      add(s, true);
+      live_++;
+    }
+
+    /** Leaves a hole in the node's slot */
+    void onUnlink(SMLNode<Idx,T>* arg_node, SMLNode<Idx,T>* arg_front,
+        const std::size_t arg_size)
+    {
+      std::size_t s;
+      if(false == slot_of_.find(static_cast<const void*>(arg_node), s))
+      { return; }
+      slot_of_.erase(static_cast<const void*>(arg_node));
+      slots_[s] = NULL;
+      add(s, false);
+      live_--;
+      //Too many holes : Compact (amortized over the erases)
+      if(hi_ - lo_ > 2*live_ + 32)
+      { rebuild(arg_front, arg_size); }
+    }
+
+    /** The list was relinked in a new order. Reassigns the slots. */
+    void onReorder(SMLNode<Idx,T>* arg_front, const std::size_t arg_size)
+    { rebuild(arg_front, arg_size); }
+
+    /** The node at a position (which must be less than the size) */
+    SMLNode<Idx,T>* nodeAt(const std::size_t arg_pos) const
+    {
+      //Find the slot with arg_pos live slots before it
+      std::size_t idx = 0, rem = arg_pos;
+      for(std::size_t step = top_; 0 < step; step >>= 1)
+      {
+        if(idx + step < fen_.size() && fen_[idx + step] <= rem)
+        { idx += step; rem -= fen_[idx]; }
+      }
+      return slots_[idx]; //Fenwick indices are 1-based, so idx is the slot
+    }
+
+    /** The number of nodes before the passed one */
+    bool positionOf(const SMLNode<Idx,T>* arg_node, std::size_t& ret_pos) const
+    {
+      std::size_t s;
+      if(false == slot_of_.find(static_cast<const void*>(arg_node), s))
+      { return false; }
+      std::size_t sum = 0;
+      for(std::size_t i = s; 0 < i; i -= i & (~i + 1))
+      { sum += fen_[i]; }
+      ret_pos = sum;
+      return true;
+    }
+
+    void clear()
+    {
+      slots_.clear(); fen_.clear(); slot_of_.clear();
+      lo_ = 0; hi_ = 0; live_ = 0; top_ = 0;
+    }
+
+    void reserve(const std::size_t arg_n)
+    {
+      slots_.reserve(2*arg_n + 32);
+      fen_.reserve(2*arg_n + 33);
+      slot_of_.reserve(arg_n);
+    }
+
+    void swap(CMappedListRankFenwick<Idx,T>& arg_swap_obj)
+    {
+      slots_.swap(arg_swap_obj.slots_);
+      fen_.swap(arg_swap_obj.fen_);
+      slot_of_.swap(arg_swap_obj.slot_of_);
+      std::swap(lo_, arg_swap_obj.lo_);
+      std::swap(hi_, arg_swap_obj.hi_);
+      std::swap(live_, arg_swap_obj.live_);
+      std::swap(top_, arg_swap_obj.top_);
+    }
+
+  private:
+    /** Counts (or uncounts) slot s in the Fenwick tree */
+    void add(const std::size_t arg_s, const bool arg_inc)
+    {
+      for(std::size_t i = arg_s+1; i < fen_.size(); i += i & (~i + 1))
+      { if(arg_inc) { fen_[i]++; } else { fen_[i]--; } }
+    }
+
+    /** Lays out the list's nodes in the middle of a fresh slot array,
+     * with n/2 + 16 free slots at each end. O(n). */
+    void rebuild(SMLNode<Idx,T>* arg_front, const std::size_t arg_size)
+    {
+      const std::size_t room = arg_size/2 + 16, cap = arg_size + 2*room;
+      slots_.assign(cap, NULL);
+      slot_of_.clear();
+      slot_of_.reserve(arg_size);
+      SMLNode<Idx,T>* t = arg_front;
+      for(std::size_t i=0; i<arg_size; ++i, t = t->next_)
+      {
+        slots_[room+i] = t;
+        slot_of_.insert(static_cast<const void*>(t), room+i);
+      }
+      lo_ = room; hi_ = room + arg_size; live_ = arg_size;
+
+      //Build the Fenwick tree in O(n)
+      fen_.assign(cap+1, 0);
+      for(std::size_t i=1; i<=cap; ++i)
+      {
+        if(NULL != slots_[i-1]) { fen_[i]++; }
+        const std::size_t j = i + (i & (~i + 1));
+        if(j <= cap) { fen_[j] += fen_[i]; }
+      }
+      for(top_ = 1; top_*2 <= cap; top_ *= 2) {}
+    }
+
+    /** The nodes in list order (NULL for holes) */
+    std::vector<SMLNode<Idx,T>*> slots_;
+    /** The Fenwick tree over the live slots (1-based) */
+    std::vector<std::size_t> fen_;
+    /** Maps each node to its slot */
+    CMappedListPtrTable<std::size_t> slot_of_;
+    /** The used slots are [lo_, hi_) */
+    std::size_t lo_, hi_;
+    /** The number of nodes */
+    std::size_t live_;
+    /** The largest power of two in the Fenwick tree's size */
+    std::size_t top_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTRANK_HPP_*/
@@ -0,0 +1,362 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListShared.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTSHARED_HPP_
+#define CMAPPEDLISTSHARED_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#ifdef DEBUG
+#include <iostream>
+#endif
+
+namespace sutil
+{
+  /** A self-relative pointer. Stores the distance from itself to the
+   * target (0 for NULL), so it stays valid when the memory holding it
+   * is mapped at a different address (eg. shared memory in another
+   * process).
+   *
+   * NOTE : Only use it for targets inside the same memory block.
+   *        It can't be copied (a copy would point somewhere else). */
+  template <typename TP>
+  class COffsetPtr
+  {
+  public:
+    COffsetPtr() = default;
+
+    TP* get() const
+    {
+      if(0 == off_) { return NULL; }
+      return reinterpret_cast<TP*>(const_cast<char*>(
+          reinterpret_cast<const char*>(this) + off_));
+    }
+
+    void set(const TP* arg_ptr)
+    {
+      if(NULL == arg_ptr) { off_ = 0; return; }
+      off_ = reinterpret_cast<const char*>(arg_ptr) - reinterpret_cast<const char*>(this);
+    }
+
+    TP* operator -> () const
+    { return get(); }
+
+  private:
+    COffsetPtr(const COffsetPtr&) = delete;
+    COffsetPtr& operator = (const COffsetPtr&) = delete;
+
+    std::ptrdiff_t off_;
+  };
+
+  /** A fixed capacity mapped list that lives entirely inside one block
+   * of memory (its nodes, keys and hash index), and links everything
+   * with self-relative offsets (COffsetPtr) instead of raw pointers.
+   *
+   * It is meant to be the MemType of a CSharedMemory. A writer process
+   * builds the list in the segment, and reader processes (which may
+   * map the segment at other addresses) iterate over it and look up
+   * elements in place, without copying or deserializing anything.
+   *
+   * Usage:
+   *   typedef sutil::CMappedListShared<int,SBody,1024> TShmList;
+   *   //Writer
+   *   sutil::CSharedMemory<TShmList,char,true> shm(key,'x'); //Aligned
+   *   shm.shmCreate(); shm.data_->init();
+   *   shm.data_->create(7, body);
+   *   *shm.data_signal_ = 'r'; //Tell the readers
+   *   //Reader
+   *   shm.shmRead();
+   *   if(shm.data_->isInit()) { const SBody* b = shm.data_->at(7); ... }
+   *
+   * NOTE : The memory isn't constructed; call init() once (as the
+   *        writer) before using it. Its CSharedMemory must align the
+   *        data (AlignData = true).
+   *
+   * NOTE 2 : Idx and T must be trivially copyable, and hashes must be
+   *          the same in all processes (true for std::hash on ints in
+   *          the same executable). Use fixed size keys (eg. ints or
+   *          char arrays), not std::string.
+   *
+   * NOTE 3 : There is no locking. Readers must not read while the
+   *          writer changes the list (use the CSharedMemory signal to
+   *          hand over). */
+  template <typename Idx, typename T, std::size_t MaxNodes,
+            typename Hash = std::hash<Idx> >
+  class CMappedListShared
+  {
+    static_assert(std::is_trivially_copyable<Idx>::value,
+        "CMappedListShared : Idx must be trivially copyable");
+    static_assert(std::is_trivially_copyable<T>::value,
+        "CMappedListShared : T must be trivially copyable");
+    static_assert(0 < MaxNodes, "CMappedListShared : MaxNodes must be positive");
+
+    /** The smallest power of two >= n */
+    static constexpr std::size_t pow2(const std::size_t n, const std::size_t p = 1)
+    { return (p >= n) ? p : pow2(n, 2*p); }
+
+    static const std::size_t NBUCKETS = pow2(MaxNodes);
+
+    /** Written by init(). Tells readers that the memory is formatted. */
+    static const std::uint64_t MAGIC = 0x5355544c53484d31ULL;
+
+    struct SNode
+    {
+      Idx id_;
+      T data_;
+      COffsetPtr<SNode> next_, prev_;
+      /** The next node in the same hash bucket (or free list) */
+      COffsetPtr<SNode> hnext_;
+      bool used_;
+    };
+
+  public:
+    /** Formats the memory as an empty list. Call this once, as the
+     * writer, before using it. */
+    void init()
+    {
+      size_ = 0;
+      front_.set(NULL); back_.set(NULL);
+      for(std::size_t i=0; i<NBUCKETS; ++i) { buckets_[i].set(NULL); }
+      for(std::size_t i=0; i<MaxNodes; ++i)
+      {
+        nodes_[i].used_ = false;
+        nodes_[i].next_.set(NULL); nodes_[i].prev_.set(NULL);
+        nodes_[i].hnext_.set(i+1 < MaxNodes ? &nodes_[i+1] : NULL);
+      }
+      free_.set(&nodes_[0]);
+      magic_ = MAGIC;
+    }
+
+    /** Whether init() has been called on this memory */
+    bool isInit() const
+    { return MAGIC == magic_; }
+
+    /** Adds a copy of arg_t. By default inserts at the front.
+     * Returns NULL if the idx exists or the list is full. */
+    T* create(const Idx& arg_idx, const T& arg_t, const bool insert_at_start=true)
+    {
+      SNode* node = allocNode(arg_idx, insert_at_start);
+      if(NULL == node) { return NULL; }
+      node->data_ = arg_t;
+      return &(node->data_);
+    }
+
+    /** Adds a value initialized element */
+    T* create(const Idx& arg_idx, const bool insert_at_start=true)
+    { return create(arg_idx, T(), insert_at_start); }
+
+    /** Idx based lookup. O(1) on average. NULL if absent. */
+    T* at(const Idx& arg_idx)
+    {
+      SNode* node = findNode(arg_idx);
+      return (NULL == node) ? NULL : &(node->data_);
+    }
+
+    const T* at(const Idx& arg_idx) const
+    {
+      const SNode* node = findNode(arg_idx);
+      return (NULL == node) ? NULL : &(node->data_);
+    }
+
+    const T* at_const(const Idx& arg_idx) const
+    { return at(arg_idx); }
+
+    /** The idx of an element in the list. NULL if it isn't one. */
+    const Idx* getIndex(const T* arg_t) const
+    {
+      const SNode* node = nodeOf(arg_t);
+      return (NULL == node) ? NULL : &(node->id_);
+    }
+
+    /** Erases an element. Referenced by its idx. */
+    bool erase(const Idx& arg_idx)
+    { return eraseNode(findNode(arg_idx)); }
+
+    /** Erases an element. Referenced by its memory location. O(1). */
+    bool erase(const T* arg_t)
+    { return eraseNode(const_cast<SNode*>(nodeOf(arg_t))); }
+
+    /** Empties the list */
+    bool clear()
+    { init(); return true; }
+
+    std::size_t size() const
+    { return size_; }
+
+    bool empty() const
+    { return 0 == size_; }
+
+    /** The maximum number of elements */
+    static std::size_t getCapacity()
+    { return MaxNodes; }
+
+    /** An stl style (forward) iterator. !it is the element's idx. */
+    template <typename TIt, typename NodeIt>
+    class iterator_base : public std::iterator<std::forward_iterator_tag, TIt>
+    {
+      NodeIt* pos_;
+    public:
+      explicit iterator_base(NodeIt* arg_pos = NULL) : pos_(arg_pos) {}
+
+      bool operator == (const iterator_base& other) const
+      { return pos_ == other.pos_; }
+
+      bool operator != (const iterator_base& other) const
+      { return pos_ != other.pos_; }
+
+      TIt& operator * () const
+      { return pos_->data_; }
+
+      TIt* operator -> () const
+      { return &(pos_->data_); }
+
+      const Idx& operator ! () const
+      { return pos_->id_; }
+
+      iterator_base& operator ++ ()
+      { pos_ = pos_->next_.get(); return *this; }
+
+      iterator_base operator ++ (int)
+      { iterator_base tmp(*this); pos_ = pos_->next_.get(); return tmp; }
+    };
+
+    typedef iterator_base<T, SNode> iterator;
+    typedef iterator_base<const T, const SNode> const_iterator;
+
+    iterator begin()
+    { return iterator(front_.get()); }
+
+    iterator end()
+    { return iterator(); }
+
+    const_iterator begin() const
+    { return const_iterator(front_.get()); }
+
+    const_iterator end() const
+    { return const_iterator(); }
+
+  private:
+    std::size_t bucketOf(const Idx& arg_idx) const
+    {
+      unsigned long long h = static_cast<unsigned long long>(Hash()(arg_idx));
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      return static_cast<std::size_t>(h) & (NBUCKETS-1);
+    }
+
+    SNode* findNode(const Idx& arg_idx) const
+    {
+      if(0 == size_) { return NULL; }
+      for(SNode* n = buckets_[bucketOf(arg_idx)].get(); NULL != n; n = n->hnext_.get())
+      { if(n->id_ == arg_idx) { return n; } }
+      return NULL;
+    }
+
+    /** The node holding an element (NULL if the pointer isn't a used
+     * element of this list) */
+    const SNode* nodeOf(const T* arg_t) const
+    {
+      if(NULL == arg_t) { return NULL; }
+      const char* p = reinterpret_cast<const char*>(arg_t) - offsetof(SNode, data_);
+      const char* first = reinterpret_cast<const char*>(&nodes_[0]);
+      if(p < first || p >= reinterpret_cast<const char*>(&nodes_[0] + MaxNodes) ||
+          0 != (p - first) % sizeof(SNode))
+      { return NULL; }
+      const SNode* node = reinterpret_cast<const SNode*>(p);
+      return node->used_ ? node : NULL;
+    }
+
+    SNode* allocNode(const Idx& arg_idx, const bool insert_at_start)
+    {
+      if(NULL != findNode(arg_idx))
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedListShared::create() : Error. Idx exists. Tried to add duplicate entry";
+#endif
+        return NULL;
+      }
+      SNode* node = free_.get();
+      if(NULL == node)
+      {
+#ifdef DEBUG
+        std::cerr<<"\nCMappedListShared::create() : Error. The list is full.";
+#endif
+        return NULL;
+      }
+      free_.set(node->hnext_.get());
+
+      node->id_ = arg_idx;
+      node->used_ = true;
+      COffsetPtr<SNode>& bucket = buckets_[bucketOf(arg_idx)];
+      node->hnext_.set(bucket.get());
+      bucket.set(node);
+
+      if(0 == size_)
+      {
+        node->next_.set(NULL); node->prev_.set(NULL);
+        front_.set(node); back_.set(node);
+      }
+      else if(insert_at_start)
+      {
+        node->prev_.set(NULL);
+        node->next_.set(front_.get());
+        front_->prev_.set(node);
+        front_.set(node);
+      }
+      else
+      {
+        node->next_.set(NULL);
+        node->prev_.set(back_.get());
+        back_->next_.set(node);
+        back_.set(node);
+      }
+      size_++;
+      return node;
+    }
+
+    bool eraseNode(SNode* arg_node)
+    {
+      if(NULL == arg_node) { return false; }
+
+      //Unlink it from its hash bucket
+      COffsetPtr<SNode>* link = &buckets_[bucketOf(arg_node->id_)];
+      while(link->get() != arg_node) { link = &(link->get()->hnext_); }
+      link->set(arg_node->hnext_.get());
+
+      //Unlink it from the list
+      SNode *prev = arg_node->prev_.get(), *next = arg_node->next_.get();
+      if(NULL == prev) { front_.set(next); } else { prev->next_.set(next); }
+      if(NULL == next) { back_.set(prev); } else { next->prev_.set(prev); }
+
+      arg_node->used_ = false;
+      arg_node->hnext_.set(free_.get());
+      free_.set(arg_node);
+      size_--;
+      return true;
+    }
+
+    std::uint64_t magic_;
+    std::size_t size_;
+    COffsetPtr<SNode> front_, back_;
+    /** Unused nodes (chained through hnext_) */
+    COffsetPtr<SNode> free_;
+    COffsetPtr<SNode> buckets_[NBUCKETS];
+    SNode nodes_[MaxNodes];
+  };
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTSHARED_HPP_*/
@@ -0,0 +1,121 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CMappedListStats.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CMAPPEDLISTSTATS_HPP_
+#define CMAPPEDLISTSTATS_HPP_
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CRegisteredPrintables.hpp>
+
+#include <cstddef>
+#include <ostream>
+
+namespace sutil
+{
+  /** The counters kept by a CMappedListStatsCount */
+  struct SMappedListStats
+  {
+    /** Nodes added (create, emplace, insert, bulk loads and copies) */
+    std::size_t creates_;
+    /** Nodes erased (by Idx or by pointer; clear() isn't counted) */
+    std::size_t erases_;
+    /** Idx lookups (at(Idx), at_const(Idx), erase(Idx) etc.) */
+    std::size_t lookups_;
+    /** Positional lookups (at(size_t), getIndexAt etc.) */
+    std::size_t pos_lookups_;
+    /** Nodes walked (position cache rebuilds and full list walks) */
+    std::size_t nodes_walked_;
+    /** Node allocations and deallocations */
+    std::size_t allocs_;
+    std::size_t frees_;
+    /** Bytes held by the nodes, their Idx and their T */
+    std::size_t bytes_held_;
+
+    SMappedListStats()
+    { reset(); }
+
+    void reset()
+    {
+      creates_ = 0; erases_ = 0; lookups_ = 0; pos_lookups_ = 0;
+      nodes_walked_ = 0; allocs_ = 0; frees_ = 0; bytes_held_ = 0;
+    }
+  };
+
+  /** A stats policy for CMappedList (and its subclasses) that counts
+   * what the list does. See CMappedListStatsNone for the hooks.
+   *
+   * A high nodes_walked_ relative to pos_lookups_ means the position
+   * cache is rebuilt often (ie. positional access is interleaved with
+   * creates or erases), which is O(n) per rebuild.
+   *
+   * Usage:
+   *   sutil::CMappedTree<std::string, SNode, sutil::CMappedListAllocNew<std::string,SNode>,
+   *       sutil::CMappedListIndexMap<std::string,SNode>, sutil::CMappedListStatsCount> tree;
+   *   ...
+   *   tree.getStats().reset();
+   *   controlLoop(tree);
+   *   std::cout<<tree.getStats().get().nodes_walked_;
+   *   //Or register it to print it by name
+   *   sutil::printables::add("tree_stats", tree.getStats());
+   *
+   * NOTE : The counters aren't atomic. Don't share a counting list
+   *        between threads (not even for const access). */
+  class CMappedListStatsCount
+  {
+  public:
+    void onCreate() const { counts_.creates_++; }
+    void onErase() const { counts_.erases_++; }
+    void onLookup() const { counts_.lookups_++; }
+    void onPosLookup() const { counts_.pos_lookups_++; }
+    void onWalk(const std::size_t arg_n) const { counts_.nodes_walked_ += arg_n; }
+
+    void onAlloc(const std::size_t arg_bytes) const
+    { counts_.allocs_++; counts_.bytes_held_ += arg_bytes; }
+
+    void onFree(const std::size_t arg_bytes) const
+    { counts_.frees_++; counts_.bytes_held_ -= arg_bytes; }
+
+    /** The counters so far */
+    const SMappedListStats& get() const
+    { return counts_; }
+
+    /** Zeroes the activity counters. Keeps bytes_held_ (the list
+     * still holds its nodes). */
+    void reset()
+    {
+      const std::size_t bytes = counts_.bytes_held_;
+      counts_.reset();
+      counts_.bytes_held_ = bytes;
+    }
+
+  private:
+    mutable SMappedListStats counts_;
+  };
+
+  /** Prints the counters (for CRegisteredPrintables) */
+  template <>
+  inline void printToStream<SMappedListStats>(std::ostream& ostr,
+      const SMappedListStats& arg_data)
+  {
+    ostr<<"creates "<<arg_data.creates_<<", erases "<<arg_data.erases_
+        <<", lookups "<<arg_data.lookups_<<", pos_lookups "<<arg_data.pos_lookups_
+        <<", nodes_walked "<<arg_data.nodes_walked_<<", allocs "<<arg_data.allocs_
+        <<", frees "<<arg_data.frees_<<", bytes_held "<<arg_data.bytes_held_;
+  }
+
+  template <>
+  inline void printToStream<CMappedListStatsCount>(std::ostream& ostr,
+      const CMappedListStatsCount& arg_data)
+  { printToStream<SMappedListStats>(ostr, arg_data.get()); }
+
+}//End of namespace sutil
+
+#endif /*CMAPPEDLISTSTATS_HPP_*/
@@ -15,6 +15,7 @@ See the Readme.txt file in the root folder for licensing information.
 #include <sutil/CMappedList.hpp>
 
 #include <vector>
+#include <algorithm>
 
 #ifdef DEBUG
 #include <iostream>
@@ -26,9 +27,17 @@ namespace sutil
    *
    * It is an extension of a PileMap, which itself is a
    * collection of pointers (memory managed) stored in a
-   * linked list. */
-  template <typename Idx, typename T>
-  class CMappedMultiLevelList  : public CMappedList<Idx,T>
+   * linked list.
+   *
+   * The Alloc, Index, Stats, Rank and NodeTable arguments are passed on
+   * to the CMappedList (see its docs). Pass a CMappedListNodeTableHash
+   * to erase by pointer without walking the list. */
+  template <typename Idx, typename T, typename Alloc = CMappedListAllocNew<Idx,T>,
+            typename Index = CMappedListIndexMap<Idx,T>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<Idx,T>,
+            typename NodeTable = CMappedListNodeTableNone<Idx,T> >
+  class CMappedMultiLevelList  : public CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>
   {
   public:
     /** Constructor : Empties the data structure */
@@ -43,8 +52,13 @@ namespace sutil
     virtual T* create(const Idx& arg_idx, const T &arg_node2add,
         const std::size_t arg_priority);
 
+    /** Moves a node (and its idx) into the mapped list and inserts its
+     * vector into the appropriate slot in the vector-list */
+    virtual T* create(Idx&& arg_idx, T &&arg_node2add,
+        const std::size_t arg_priority);
+
     /** Adds a node to the mapped list and inserts its vector into
-     * the appropriate slot in the vector-list. Uses the copy-constructor. */
+     * the appropriate slot in the vector-list. Default constructs the node in place. */
     virtual T* create(const Idx& arg_idx, const std::size_t arg_priority);
 
     /** Adds an existing object to the mapped list and inserts its vector into
@@ -52,15 +66,80 @@ namespace sutil
     virtual T* insert(const Idx& arg_idx, T *arg_node2add,
         const std::size_t arg_priority);
 
+    /** Bulk load : Adds an element for each (Idx, T) pair in
+     * [arg_first, arg_last) (see CMappedList::createRange). The i'th
+     * element goes to the priority level at arg_pri_first[i].
+     *
+     * Returns false (and adds nothing) if an idx is repeated or exists. */
+    template <typename ForwardIt, typename PriIt>
+    bool createRange(ForwardIt arg_first, ForwardIt arg_last, PriIt arg_pri_first);
+
+    /** Clears the list and bulk loads the passed range */
+    template <typename ForwardIt, typename PriIt>
+    bool assign(ForwardIt arg_first, ForwardIt arg_last, PriIt arg_pri_first)
+    {
+      clear();
+      return createRange(arg_first, arg_last, arg_pri_first);
+    }
+
 
     /** Assignment operator : Performs a deep-copy (std container requirement).
      * Beware; This can be quite slow. */
-    virtual CMappedMultiLevelList<Idx,T>& operator = (const CMappedMultiLevelList<Idx,T>& arg_rhs)
+    virtual CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (const CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_rhs)
     {
       deepCopy(&arg_rhs);
       return *this;
     }
 
+    /** Assignment from a CMappedList : Overrides (instead of hiding) the
+     * CMappedList's. Deep-copies a multi-level list, and puts a plain
+     * list's elements at priority level 0. */
+    virtual CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (const CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_rhs)
+    {
+      if(this == &arg_rhs) { return *this; }
+      const CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* ml =
+          dynamic_cast<const CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>*>(&arg_rhs);
+      if(NULL != ml) { deepCopy(ml); return *this; }
+      clear();
+      typename CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::const_iterator it, ite;
+      for(it = arg_rhs.begin(), ite = arg_rhs.end(); it!=ite; ++it)
+      { create(!it, *it, static_cast<std::size_t>(0)); }
+      return *this;
+    }
+
+    /** Copy Constructor : Performs a deep-copy (std container requirement).
+     * 'explicit' makes sure that only a CMappedMultiLevelList can be copied. */
+    explicit CMappedMultiLevelList(const CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_br) :
+        CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>(), pri_levels_(0)
+    { deepCopy(&arg_br); }
+
+    /** Move Constructor : Takes over the passed list's nodes and priority
+     * levels in O(1). The passed list is left empty. */
+    CMappedMultiLevelList(CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_br) noexcept :
+        CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>(), pri_levels_(0)
+    { CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_br); }
+
+    /** Move assignment : Clears this list and takes over the passed
+     * list's nodes in O(1). The passed list is left empty. */
+    CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
+    {
+      if(this != &arg_rhs)
+      {
+        clear();
+        CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_rhs);
+      }
+      return *this;
+    }
+
+    /** Swaps the nodes and the priority levels with the passed list. O(1). */
+    void swap(CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_swap_obj) noexcept
+    {
+      CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_swap_obj);
+      mlvec_.swap(arg_swap_obj.mlvec_);
+      map_nodeptr2pri_.swap(arg_swap_obj.map_nodeptr2pri_);
+      std::swap(pri_levels_, arg_swap_obj.pri_levels_);
+    }
+
     /** Erases an element from the list.
      * Referenced by the element's memory location */
     virtual bool erase(const T* arg_t);
@@ -69,6 +148,20 @@ namespace sutil
      * Referenced by its index */
     virtual bool erase(const Idx& arg_idx);
 
+    /** Erases every element for which arg_pred(const T&) is true. Walks
+     * each priority level once, compacts it (and drops the empty levels
+     * at the end) once, and walks the list once. O(n). Returns the
+     * number erased. */
+    template <typename Pred>
+    std::size_t erase_if(Pred arg_pred);
+
+    /** Erases the elements whose Idx is in [arg_first, arg_last) (and
+     * skips the keys that aren't in the list). Finds each by its Idx,
+     * then compacts each touched priority level once and walks the list
+     * once. Returns the number erased. */
+    template <typename ForwardIt>
+    std::size_t erase(ForwardIt arg_first, ForwardIt arg_last);
+
     /** Clears all elements from the list */
     virtual bool clear();
 
@@ -110,6 +203,24 @@ namespace sutil
     /** The priority levels this multi-level map has */
     std::size_t pri_levels_;
 
+    /** Erases the victims' nodes from the list in one walk (which also
+     * keeps the sort order). The victims must already be out of the
+     * levels. Returns the number erased. */
+    std::size_t eraseVictims(const CMappedListPtrTable<bool>& arg_victims)
+    {
+      return CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase_if(
+          [&arg_victims](const T& arg_t)
+          { bool b; return arg_victims.find(static_cast<const void*>(&arg_t), b); });
+    }
+
+    /** Removes the empty levels at the end and updates pri_levels_ */
+    void dropEmptyLevels()
+    {
+      while(false == mlvec_.empty() && mlvec_.back().empty())
+      { mlvec_.pop_back(); }
+      pri_levels_ = mlvec_.size();
+    }
+
   protected:
     /** These functions exist in the parent class, but are not to be
      * called by pointers to this class. The overloaded equivalents
@@ -117,45 +228,80 @@ namespace sutil
      * the documentation related to -Woverloaded-virtual
      *
      * NOTE TODO : This needs to be protected here.
-     * T* CMappedList<Idx,T>::create(const Idx & arg_idx, const bool insert_at_start);
+     * T* CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(const Idx & arg_idx, const bool insert_at_start);
      */
 
 
     /** Copy-Constructor : Does a deep copy of the mapped multi level list to
      *  get a new one.
-     * NOTE : This uses the passed mapped list's iterator construct. */
-    virtual bool deepCopy(const CMappedMultiLevelList<Idx,T>* arg_br);
+     * NOTE : Clones the nodes (see CMappedList::cloneNodes) and then
+     *        translates the priority levels through the clone's address
+     *        table. The list and each level keep their order. */
+    virtual bool deepCopy(const CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* arg_br);
 
   }; //End of template class
 
+  /** A CMappedMultiLevelList that can't be derived from, so that calls
+   * on it aren't virtual and can be inlined (see CMappedListFinal).
+   * The behaviour is the same as a CMappedMultiLevelList's. */
+  template <typename Idx, typename T, typename Alloc = CMappedListAllocNew<Idx,T>,
+            typename Index = CMappedListIndexMap<Idx,T>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<Idx,T>,
+            typename NodeTable = CMappedListNodeTableNone<Idx,T> >
+  class CMappedMultiLevelListFinal final : public CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>
+  {
+    typedef CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable> base;
+  public:
+    CMappedMultiLevelListFinal() : base() {}
+
+    /** Copy Constructor : Performs a deep-copy (see CMappedMultiLevelList) */
+    explicit CMappedMultiLevelListFinal(const CMappedMultiLevelListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_br) :
+        base(arg_br) {}
+
+    /** Move Constructor : Takes over the passed list's nodes in O(1) */
+    CMappedMultiLevelListFinal(CMappedMultiLevelListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_br) noexcept :
+        base(std::move(arg_br)) {}
+
+    using base::operator =;
+
+    CMappedMultiLevelListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (const CMappedMultiLevelListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& arg_rhs)
+    { base::operator = (arg_rhs); return *this; }
+
+    CMappedMultiLevelListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedMultiLevelListFinal<Idx,T,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
+    { base::operator = (std::move(arg_rhs)); return *this; }
+
+    virtual ~CMappedMultiLevelListFinal() {}
+  };
+
   /***************************************************************
    *******************************Function Definitions*************
    ****************************************************************
    */
 
   /** Constructor. Sets default values.   */
-  template <typename Idx, typename T>
-  CMappedMultiLevelList<Idx,T>::CMappedMultiLevelList() :
-  CMappedList<Idx,T>::CMappedList()
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::CMappedMultiLevelList() :
+  CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::CMappedList()
   { mlvec_.clear(); pri_levels_ = 0; }
 
   /** Does nothing itself.
    * Calls CMappedList::~CMappedList() which
    * destroys the (dynamically allocated)
    * nodes in the node linked list.   */
-  template <typename Idx, typename T>
-  CMappedMultiLevelList<Idx,T>::~CMappedMultiLevelList()
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::~CMappedMultiLevelList()
   { mlvec_.clear(); map_nodeptr2pri_.clear(); pri_levels_=0; }
 
 
   /** Adds a node at the given level and returns its address.   */
-  template <typename Idx, typename T>
-  T* CMappedMultiLevelList<Idx,T>::create(
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(
       const Idx& arg_idx, const T & arg_node2add,
       const std::size_t arg_priority)
   {
     //Add the node.
-    T* tLnk = CMappedList<Idx,T>::create(arg_idx,arg_node2add);
+    T* tLnk = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(arg_idx,arg_node2add);
 
     if(NULL!=tLnk)
     {
@@ -171,12 +317,36 @@ namespace sutil
     return tLnk;
   }
 
-  template <typename Idx, typename T>
-  T* CMappedMultiLevelList<Idx,T>::create(
+  /** Moves a node in at the given level and returns its address.   */
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(
+      Idx&& arg_idx, T && arg_node2add,
+      const std::size_t arg_priority)
+  {
+    //Add the node.
+    T* tLnk = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(
+        std::move(arg_idx),std::move(arg_node2add));
+
+    if(NULL!=tLnk)
+    {
+      for(std::size_t i=mlvec_.size(); i <= arg_priority; i++)
+      {
+        std::vector<T*> tmp;
+        mlvec_.push_back(tmp);
+        pri_levels_++;//Every push back increases pri levels.
+      }
+      mlvec_[arg_priority].push_back(tLnk);
+      map_nodeptr2pri_.insert(std::pair<T*,std::size_t>(tLnk,arg_priority));
+    }
+    return tLnk;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(
       const Idx& arg_idx, const std::size_t arg_priority)
   {
     //Add the node.
-    T* tLnk = CMappedList<Idx,T>::create(arg_idx);
+    T* tLnk = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::create(arg_idx);
 
     if(NULL!=tLnk)
     {
@@ -195,13 +365,13 @@ namespace sutil
 
 
   /** Adds a node at the given level and returns its address.   */
-  template <typename Idx, typename T>
-  T* CMappedMultiLevelList<Idx,T>::insert(
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  T* CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::insert(
       const Idx& arg_idx, T *arg_node2add,
       const std::size_t arg_priority)
   {
     //Add the node.
-    T* tLnk = CMappedList<Idx,T>::create(arg_idx,arg_node2add);
+    T* tLnk = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::insert(arg_idx,arg_node2add);
 
     if(NULL!=tLnk)
     {
@@ -218,68 +388,80 @@ namespace sutil
   }
 
 
-  template <typename Idx, typename T>
-  bool CMappedMultiLevelList<Idx,T>::
-  deepCopy(const CMappedMultiLevelList<Idx,T>* arg_br)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename ForwardIt, typename PriIt>
+  bool CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::createRange(
+      ForwardIt arg_first, ForwardIt arg_last, PriIt arg_pri_first)
+  {
+    std::vector<T*> created;
+    if(false == CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::createRangeImpl(arg_first, arg_last, &created))
+    { return false; }
+
+    typename std::vector<T*>::iterator it,ite;
+    for(it = created.begin(), ite = created.end(); it!=ite; ++it, ++arg_pri_first)
+    {
+      const std::size_t pri = static_cast<std::size_t>(*arg_pri_first);
+      for(std::size_t i=mlvec_.size(); i <= pri; i++)
+      {
+        std::vector<T*> tmp;
+        mlvec_.push_back(tmp);
+        pri_levels_++;//Every push back increases pri levels.
+      }
+      mlvec_[pri].push_back(*it);
+      map_nodeptr2pri_.insert(std::pair<T*,std::size_t>(*it,pri));
+    }
+    return true;
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::
+  deepCopy(const CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>* arg_br)
   {//Deep copy.
+    if(this == arg_br) { return true; }
     clear();
 
     /**Set the current mapped list to the new mapped list**/
     if(0 == arg_br->size())
+    { return true; }
+
+    CMappedListPtrTable<SMLNode<Idx,T>*> remap;
+    if(false == CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::cloneNodes(*arg_br, remap))
     {
-      CMappedList<Idx,T>::front_ = NULL;
-      CMappedList<Idx,T>::map_.clear();
-      CMappedList<Idx,T>::size_ = 0;
-      mlvec_.clear(); map_nodeptr2pri_.clear();
+#ifdef DEBUG
+      std::cerr<<"\nCMultiLevelPileMap<Idx,T>::deepCopy() Error :Deep copy failed. Resetting multi-level mapped list.";
+#endif
+      clear(); return false;
     }
-    else
+
+    //Now recreate the priority levels (in the same order)
+    mlvec_.resize(arg_br->mlvec_.size());
+    for(std::size_t pri=0; pri<arg_br->mlvec_.size(); ++pri)
     {
-      //Copy over each element.
-      typename CMappedList<Idx,T>::const_iterator it,ite;
-      for(it = arg_br->CMappedList<Idx,T>::begin(), ite = arg_br->CMappedList<Idx,T>::end();
-          it!=ite; ++it)
+      mlvec_[pri].reserve(arg_br->mlvec_[pri].size());
+      typename std::vector<T*>::const_iterator it,ite;
+      for(it = arg_br->mlvec_[pri].begin(), ite = arg_br->mlvec_[pri].end(); it!=ite; ++it)
       {
-        T* tmp = CMappedList<Idx,T>::create(!it,*it);
+        T* tmp = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::cloneRemap(remap, *it);
         if(NULL == tmp)
         {
-#ifdef DEBUG
-          std::cerr<<"\nCMultiLevelPileMap<Idx,T>::deepCopy() Error :Deep copy failed. Resetting multi-level mapped list.";
-#endif
-          clear(); return false;
-        }
-
-        //Now recreate the priority map
-        const T* tmpptr = &(*it); //Deref iterator to get ref. Get ref's addr to access priority in map.
-        if(arg_br->map_nodeptr2pri_.find(tmpptr) ==
-            arg_br->map_nodeptr2pri_.end())
-        {
 #ifdef DEBUG
           std::cerr<<"\nCMultiLevelPileMap<Idx,T>::deepCopy() Error :Did not find a node in the priority map.";
 #endif
           clear(); return false;
         }
-
-        std::size_t pri = arg_br->map_nodeptr2pri_.at(tmpptr);
-        map_nodeptr2pri_.insert(std::pair<T*,std::size_t>(tmp,pri));
-
-        //Now add the entry to the vector
-        for(std::size_t i=mlvec_.size(); i <= pri; i++)
-        {
-          std::vector<T*> tmp;
-          mlvec_.push_back(tmp);
-          pri_levels_++;//Every push back increases pri levels.
-        }
         mlvec_[pri].push_back(tmp);
+        map_nodeptr2pri_.insert(std::pair<const T*,std::size_t>(tmp,pri));
       }
     }
+    pri_levels_ = arg_br->pri_levels_;
     return true;
   }
 
-  template <typename Idx, typename T>
-  bool CMappedMultiLevelList<Idx,T>::erase(const T* arg_t)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(const T* arg_t)
   {
     bool flag;
-    if((NULL==CMappedList<Idx,T>::front_) || (NULL==arg_t))
+    if((NULL==CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::front_) || (NULL==arg_t))
     { return false;  }
     else
     {
@@ -322,7 +504,7 @@ namespace sutil
       map_nodeptr2pri_.erase(arg_t);
 
       //Remove it from the mapped list (deallocate memory)
-      flag = CMappedList<Idx,T>::erase(arg_t);
+      flag = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(arg_t);
       if(false == flag)
       { return false; }
     }
@@ -330,15 +512,15 @@ namespace sutil
     return true;
   }
 
-  template <typename Idx, typename T>
-  bool CMappedMultiLevelList<Idx,T>::erase(const Idx& arg_idx)
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(const Idx& arg_idx)
   {
     bool flag;
-    if(NULL==CMappedList<Idx,T>::front_)
+    if(NULL==CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::front_)
     { return false;  }
     else
     {
-      T* t_ptr = CMappedList<Idx,T>::at(arg_idx);
+      T* t_ptr = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::at(arg_idx);
       if(NULL == t_ptr)
       { return false; }
 
@@ -381,25 +563,89 @@ namespace sutil
       map_nodeptr2pri_.erase(t_ptr);
 
       //Remove it from the mapped list (deallocate memory)
-      flag = CMappedList<Idx,T>::erase(arg_idx);
+      flag = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(arg_idx);
       if(false == flag)
       { return false; }
     }
     pri_levels_ = mlvec_.size();
     return true;
   }
-  template <typename Idx, typename T>
-  bool CMappedMultiLevelList<Idx,T>::clear()
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename Pred>
+  std::size_t CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase_if(Pred arg_pred)
+  {
+    //Take the victims out of the levels, then erase them all in one
+    //walk of the list (erasing each by pointer could walk the list)
+    CMappedListPtrTable<bool> victims;
+    typename std::vector<std::vector<T*> >::iterator itl,itle;
+    for(itl = mlvec_.begin(), itle = mlvec_.end(); itl!=itle; ++itl)
+    {
+      //Keep the survivors in order, at the front of the level
+      typename std::vector<T*>::iterator it,ite,itw;
+      for(it = itl->begin(), ite = itl->end(), itw = it; it!=ite; ++it)
+      {
+        if(arg_pred(static_cast<const T&>(**it)))
+        {
+          map_nodeptr2pri_.erase(*it);
+          victims.insert(static_cast<const void*>(*it), true);
+        }
+        else
+        { *itw = *it; ++itw; }
+      }
+      itl->erase(itw, ite);
+    }
+    dropEmptyLevels();
+    if(0 == victims.size()) { return 0; }
+    return eraseVictims(victims);
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename ForwardIt>
+  std::size_t CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::erase(ForwardIt arg_first, ForwardIt arg_last)
+  {
+    //Find the victims by key, then take them out of the levels (once per
+    //level) and out of the list (in one walk)
+    CMappedListPtrTable<bool> victims;
+    std::vector<bool> touched(mlvec_.size(), false);
+    for(; arg_first != arg_last; ++arg_first)
+    {
+      T* t_ptr = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::at(*arg_first);
+      if(NULL == t_ptr) { continue; }
+
+      typename std::map<const T*, std::size_t>::iterator itp = map_nodeptr2pri_.find(t_ptr);
+      if(itp == map_nodeptr2pri_.end()) { continue; } //Not in a level (or a repeated key)
+
+      touched[itp->second] = true;
+      map_nodeptr2pri_.erase(itp);
+      victims.insert(static_cast<const void*>(t_ptr), true);
+    }
+    if(0 == victims.size()) { return 0; }
+
+    for(std::size_t pri=0; pri<touched.size(); ++pri)
+    {
+      if(false == touched[pri]) { continue; }
+      typename std::vector<T*>::iterator it,ite,itw;
+      bool b;
+      for(it = mlvec_[pri].begin(), ite = mlvec_[pri].end(), itw = it; it!=ite; ++it)
+      { if(false == victims.find(static_cast<const void*>(*it), b)) { *itw = *it; ++itw; } }
+      mlvec_[pri].erase(itw, ite);
+    }
+    dropEmptyLevels();
+    return eraseVictims(victims);
+  }
+
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::clear()
   {
-    CMappedList<Idx,T>::clear();
+    CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::clear();
     mlvec_.clear();
     map_nodeptr2pri_.clear();
     pri_levels_=0;
     return true;
   }
 
-  template <typename Idx, typename T>
-  std::vector<T*>* CMappedMultiLevelList<Idx,T>::
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  std::vector<T*>* CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::
   getSinglePriorityLevel(std::size_t arg_pri)
   {
     if(arg_pri > mlvec_.size())
@@ -411,8 +657,8 @@ namespace sutil
     }
   }
 
-  template <typename Idx, typename T>
-  const std::vector<T*>* CMappedMultiLevelList<Idx,T>::
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  const std::vector<T*>* CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::
   getSinglePriorityLevelConst(std::size_t arg_pri) const
   {
     if(arg_pri > mlvec_.size())
@@ -424,8 +670,8 @@ namespace sutil
     }
   }
 
-  template <typename Idx, typename T>
-  int CMappedMultiLevelList<Idx,T>::
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  int CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::
   getPriorityLevel(T* arg_t)
   {
     int ret;
@@ -438,11 +684,11 @@ namespace sutil
     return ret;
   }
 
-  template <typename Idx, typename T>
-  int CMappedMultiLevelList<Idx,T>::
+  template <typename Idx, typename T, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  int CMappedMultiLevelList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::
   getPriorityLevel(const Idx & arg_idx)
   {
-    T* t_ptr = CMappedList<Idx,T>::at(arg_idx);
+    T* t_ptr = CMappedList<Idx,T,Alloc,Index,Stats,Rank,NodeTable>::at(arg_idx);
     if(NULL == t_ptr)
     { return -1;  }
 
@@ -44,9 +44,16 @@ namespace sutil
    * NOTE 2 : You MUST set the name_ and parent_name_ fields for the objects
    *          in the mapped tree. The linkNodes function requires this
    *          to organize your (unordered) list of nodes into a tree.
+   *
+   * NOTE 3 : The Alloc, Index, Stats, Rank and NodeTable arguments are
+   *          passed on to the CMappedList (see its docs).
    */
-  template <typename TIdx, typename TNode>
-  class CMappedTree : public sutil::CMappedList<TIdx,TNode>
+  template <typename TIdx, typename TNode, typename Alloc = CMappedListAllocNew<TIdx,TNode>,
+            typename Index = CMappedListIndexMap<TIdx,TNode>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<TIdx,TNode>,
+            typename NodeTable = CMappedListNodeTableNone<TIdx,TNode> >
+  class CMappedTree : public sutil::CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>
   {
   protected:
     /** The root of the mapped tree */
@@ -58,8 +65,17 @@ namespace sutil
     /** Copy-Constructor : Does a deep copy of the mapped tree to
      * get a new one.
      *
-     * NOTE : This uses the passed mappedlist's iterator construct. */
-    virtual bool deepCopy(const CMappedTree<TIdx,TNode>* arg_mt);
+     * NOTE : Clones the nodes (see CMappedList::cloneNodes). If the passed
+     *        tree is linked, the copy's links are translated through the
+     *        clone's address table instead of being re-linked by name. */
+    virtual bool deepCopy(const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>* arg_mt);
+
+    /** Points the freshly cloned nodes' links (parent_addr_ and
+     * child_addrs_) at this tree's nodes. arg_remap maps the passed
+     * tree's node addresses to this tree's (see CMappedList::cloneNodes).
+     * Subclasses with more links (eg. graphs) extend this. */
+    virtual bool remapClonedLinks(const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_src,
+        const CMappedListPtrTable<SMLNode<TIdx,TNode>*>& arg_remap);
 
   public:
     /** Base class to simplify tree node specification (parent pointers etc.) */
@@ -71,21 +87,48 @@ namespace sutil
     /** Copy Constructor : Performs a deep-copy (std container requirement).
      * 'explicit' makes sure that only a CMappedTree can be copied. Ie. Implicit
      * copy-constructor use is disallowed.*/
-    explicit CMappedTree(const CMappedTree<TIdx,TNode>& arg_mt):
-        CMappedList<TIdx,TNode>()
-    { CMappedTree<TIdx,TNode>::deepCopy(&arg_mt); }
+    explicit CMappedTree(const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_mt):
+        CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>()
+    { CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::deepCopy(&arg_mt); }
 
     /** Default destructor : Deallocs stuff */
     virtual ~CMappedTree();
 
     /** Assignment operator : Performs a deep-copy (std container requirement).
      * Beware; This can be quite slow. */
-    virtual CMappedTree<TIdx,TNode>& operator = (const CMappedTree<TIdx,TNode>& arg_rhs)
+    virtual CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& operator = (const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_rhs)
+    {
+      CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::deepCopy(&arg_rhs);
+      return *this;
+    }
+
+    /** Move Constructor : Takes over the passed tree's nodes in O(1).
+     * The node links (parent_addr_ etc.) stay valid since the nodes
+     * don't move. The passed tree is left empty. */
+    CMappedTree(CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_mt) noexcept :
+        CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>(), root_node_(NULL), has_been_init_(false)
+    { CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_mt); }
+
+    /** Move assignment : Clears this tree and takes over the passed
+     * tree's nodes in O(1). The passed tree is left empty. */
+    CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
     {
-      CMappedTree<TIdx,TNode>::deepCopy(&arg_rhs);
+      if(this != &arg_rhs)
+      {
+        clear();
+        CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_rhs);
+      }
       return *this;
     }
 
+    /** Swaps the nodes (and the root) with the passed tree. O(1). */
+    void swap(CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_swap_obj) noexcept
+    {
+      CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::swap(arg_swap_obj);
+      std::swap(root_node_, arg_swap_obj.root_node_);
+      std::swap(has_been_init_, arg_swap_obj.has_been_init_);
+    }
+
     /** Adds a node to the mapped tree. The passed node is
      * copied and stored in a vector. A map between the idx and the
      * node is also stored.
@@ -97,6 +140,16 @@ namespace sutil
     virtual TNode* create(const TIdx& arg_idx, const TNode & arg_node2add,
         const bool arg_is_root_);
 
+    /** Adds a node to the mapped tree. The passed node (and idx) are
+     * moved into the tree, so a node's vectors etc. aren't copied.
+     *
+     * NOTE : Assumes you have set the name_  and parent_name_ fields
+     * in the passed arg_node2add
+     *
+     * NOTE 2 : There can only be one root node. */
+    virtual TNode* create(TIdx&& arg_idx, TNode && arg_node2add,
+        const bool arg_is_root_);
+
     /** Adds a node to the mapped tree.
      *
      * NOTE : Assumes you will set the name_  and parent_name_ fields
@@ -114,6 +167,35 @@ namespace sutil
     virtual TNode* insert(const TIdx& arg_idx, TNode *arg_node2add,
         const bool arg_is_root_);
 
+    /** Bulk load : Adds a node for each (TIdx, TNode) pair in the range
+     * (see CMappedList::createRange), sets arg_root_idx's node as the
+     * root and then links the tree once.
+     *
+     * Returns false (and adds nothing) if the tree already has a root,
+     * if arg_root_idx isn't in the range or if an idx is repeated.
+     * Also returns false if the nodes don't form a tree.
+     *
+     * NOTE : Assumes you have set the name_  and parent_name_ fields
+     * in the passed nodes */
+    template <typename ForwardIt>
+    bool createRange(ForwardIt arg_first, ForwardIt arg_last,
+        const TIdx& arg_root_idx);
+
+    /** Bulk load : Adds the nodes in the range under the existing
+     * root and then links the tree once. Returns false (and adds
+     * nothing) if the tree has no root or if an idx is repeated. */
+    template <typename ForwardIt>
+    bool createRange(ForwardIt arg_first, ForwardIt arg_last);
+
+    /** Clears the tree and bulk loads the passed range */
+    template <typename ForwardIt>
+    bool assign(ForwardIt arg_first, ForwardIt arg_last,
+        const TIdx& arg_root_idx)
+    {
+      clear();
+      return createRange(arg_first, arg_last, arg_root_idx);
+    }
+
     /** Organizes the links into a tree. */
     virtual bool linkNodes();
 
@@ -146,9 +228,46 @@ namespace sutil
   }; //End of template class
 
 
+  /** A CMappedTree that can't be derived from, so that calls on it
+   * (at(), size(), getRootNode() etc.) aren't virtual and can be
+   * inlined (see CMappedListFinal). The behaviour is the same as a
+   * CMappedTree's.
+   *
+   * Usage:
+   *   struct SLink : public sutil::CMappedTreeFinal<std::string,SLink>::SMTNodeBase
+   *   { ... };
+   *   sutil::CMappedTreeFinal<std::string,SLink> robot; */
+  template <typename TIdx, typename TNode, typename Alloc = CMappedListAllocNew<TIdx,TNode>,
+            typename Index = CMappedListIndexMap<TIdx,TNode>,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<TIdx,TNode>,
+            typename NodeTable = CMappedListNodeTableNone<TIdx,TNode> >
+  class CMappedTreeFinal final : public CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>
+  {
+    typedef CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable> base;
+  public:
+    CMappedTreeFinal() : base() {}
+
+    /** Copy Constructor : Performs a deep-copy (see CMappedTree) */
+    explicit CMappedTreeFinal(const CMappedTreeFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_mt) :
+        base(arg_mt) {}
+
+    /** Move Constructor : Takes over the passed tree's nodes in O(1) */
+    CMappedTreeFinal(CMappedTreeFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_mt) noexcept :
+        base(std::move(arg_mt)) {}
+
+    CMappedTreeFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& operator = (const CMappedTreeFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_rhs)
+    { base::operator = (arg_rhs); return *this; }
+
+    CMappedTreeFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& operator = (CMappedTreeFinal<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>&& arg_rhs) noexcept
+    { base::operator = (std::move(arg_rhs)); return *this; }
+
+    virtual ~CMappedTreeFinal() {}
+  };
+
   /** Node type base class (sets all the pointers etc. that will be required */
-  template <typename TIdx, typename TNode>
-  struct CMappedTree<TIdx,TNode>::SMTNodeBase
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  struct CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::SMTNodeBase
   {
   public:
     /** The index of this node */
@@ -160,11 +279,11 @@ namespace sutil
     /** The child node address pointers in the graph */
     std::vector<TNode*> child_addrs_;
 
-    /** Constructor. Sets stuff to NULL */
+    /** Constructor. Sets stuff to NULL (and the names to TIdx()) */
     SMTNodeBase()
     {
-      name_ = "";
-      parent_name_ = "";
+      name_ = TIdx();
+      parent_name_ = TIdx();
       parent_addr_ = NULL;
       child_addrs_.clear();
     }
@@ -178,8 +297,8 @@ namespace sutil
   /**
    * Constructor. Sets default values.
    */
-  template <typename TIdx, typename TNode>
-  CMappedTree<TIdx,TNode>::CMappedTree() : CMappedList<TIdx,TNode>()
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::CMappedTree() : CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>()
   {
     root_node_ = NULL;
     has_been_init_ = false;
@@ -190,25 +309,29 @@ namespace sutil
    * destroys the (dynamically allocated)
    * nodes in the node-vector.
    */
-  template <typename TIdx, typename TNode>
-  CMappedTree<TIdx,TNode>::~CMappedTree()
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::~CMappedTree()
   {
     root_node_ = NULL;
     has_been_init_ = false;
   }
 
-  template <typename TIdx, typename TNode>
-  bool CMappedTree<TIdx,TNode>::
-  deepCopy(const CMappedTree<TIdx,TNode>* const arg_mt)
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::
+  deepCopy(const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>* const arg_mt)
   {//Deep copy.
+    if(this == arg_mt) { return true; }
     bool flag;
     clear(); //Clear stuff (avoids memory leaks).
-    flag = CMappedList<TIdx,TNode>::deepCopy(
-        dynamic_cast<const CMappedTree<TIdx,TNode>*>(arg_mt));
+    CMappedListPtrTable<SMLNode<TIdx,TNode>*> remap;
+    flag = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cloneNodes(*arg_mt, remap);
     if(true == flag)
     {
-      this->root_node_ = CMappedList<TIdx,TNode>::at(arg_mt->getRootNodeConst()->name_);
-      flag = linkNodes();
+      this->root_node_ = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cloneRemap(remap, arg_mt->root_node_);
+      if(arg_mt->has_been_init_)
+      { flag = remapClonedLinks(*arg_mt, remap); }
+      else if(NULL != this->root_node_)
+      { flag = linkNodes(); }
       if(flag)
       {
         this->has_been_init_ = arg_mt->has_been_init_;
@@ -220,6 +343,30 @@ namespace sutil
     return false;
   }
 
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::
+  remapClonedLinks(const CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>& arg_src,
+      const CMappedListPtrTable<SMLNode<TIdx,TNode>*>& arg_remap)
+  {
+    typename CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::iterator it,ite;
+    for(it = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(),
+        ite = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end();
+        it != ite; ++it)
+    {
+      TNode& tmp_node = *it;
+      tmp_node.parent_addr_ = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::
+          cloneRemap(arg_remap, tmp_node.parent_addr_);
+      typename std::vector<TNode*>::iterator itc,itce;
+      for(itc = tmp_node.child_addrs_.begin(), itce = tmp_node.child_addrs_.end();
+          itc!=itce; ++itc)
+      {
+        *itc = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::cloneRemap(arg_remap, *itc);
+        if(NULL == *itc) { return false; }
+      }
+    }
+    return true;
+  }
+
   /**
    * Adds a node to the root or child node vectors depending on the
    * type of node to be added.
@@ -229,8 +376,8 @@ namespace sutil
    *
    * Passed: node to add, its index name and whether it is a root.
    */
-  template <typename TIdx, typename TNode>
-  TNode* CMappedTree<TIdx,TNode>::create(
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  TNode* CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::create(
       const TIdx& arg_idx, const TNode & arg_node2add,
       const bool arg_is_root_)
       {
@@ -244,7 +391,7 @@ namespace sutil
 
     //Add the node.
     TNode* tLnk =
-        sutil::CMappedList<TIdx,TNode>::create(arg_idx,arg_node2add);
+        sutil::CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::create(arg_idx,arg_node2add);
 
     if((arg_is_root_) && (root_node_==NULL))
     { root_node_ = tLnk;  }
@@ -252,14 +399,43 @@ namespace sutil
     return tLnk;
       }
 
+  /**
+   * Moves a node into the root or child node vectors depending on the
+   * type of node to be added.
+   *
+   * Passed: node to add, its index name and whether it is a root.
+   */
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  TNode* CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::create(
+      TIdx&& arg_idx, TNode && arg_node2add,
+      const bool arg_is_root_)
+  {
+    if((arg_is_root_)&&(NULL!=root_node_))
+    {
+#ifdef DEBUG
+      std::cerr<<"\nCMappedTree::create() : Error. Tried to insert a root node when one already exists.";
+#endif
+      return NULL;
+    }
+
+    //Add the node.
+    TNode* tLnk = sutil::CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::create(
+        std::move(arg_idx),std::move(arg_node2add));
+
+    if((arg_is_root_) && (root_node_==NULL))
+    { root_node_ = tLnk;  }
+
+    return tLnk;
+  }
+
   /**
    * Adds a node to the root or child node vectors depending on the
    * type of node to be added.
    *
    * Passed: node to add, its index name and whether it is a root.
    */
-  template <typename TIdx, typename TNode>
-  TNode* CMappedTree<TIdx,TNode>::create(
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  TNode* CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::create(
       const TIdx& arg_idx, const bool arg_is_root_)
       {
     if((arg_is_root_)&&(NULL!=root_node_))
@@ -271,7 +447,7 @@ namespace sutil
     }
 
     //Add the node.
-    TNode* tLnk = sutil::CMappedList<TIdx,TNode>::create(arg_idx);
+    TNode* tLnk = sutil::CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::create(arg_idx);
 
     if((arg_is_root_) && (NULL==root_node_))
     { root_node_ = tLnk;  }
@@ -279,6 +455,60 @@ namespace sutil
     return tLnk;
       }
 
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename ForwardIt>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::createRange(ForwardIt arg_first,
+      ForwardIt arg_last, const TIdx& arg_root_idx)
+  {
+    if(NULL!=root_node_)
+    {
+#ifdef DEBUG
+      std::cerr<<"\nCMappedTree::createRange() : Error. Tried to insert a root node when one already exists.";
+#endif
+      return false;
+    }
+
+    //Make sure the root is in the range before adding anything
+    bool flag = false;
+    for(ForwardIt it = arg_first; it != arg_last && false == flag; ++it)
+    {
+      const TIdx& idx = (*it).first;
+      flag = (false == (idx < arg_root_idx)) && (false == (arg_root_idx < idx));
+    }
+    if(false == flag)
+    {
+#ifdef DEBUG
+      std::cerr<<"\nCMappedTree::createRange() : Error. The root node isn't in the range.";
+#endif
+      return false;
+    }
+
+    if(false == CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::createRangeImpl(arg_first, arg_last, NULL))
+    { return false; }
+
+    root_node_ = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::at(arg_root_idx);
+    return linkNodes();
+  }
+
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  template <typename ForwardIt>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::createRange(ForwardIt arg_first,
+      ForwardIt arg_last)
+  {
+    if(NULL==root_node_)
+    {
+#ifdef DEBUG
+      std::cerr<<"\nCMappedTree::createRange() : Error. The tree has no root. Pass the root's idx.";
+#endif
+      return false;
+    }
+
+    if(false == CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::createRangeImpl(arg_first, arg_last, NULL))
+    { return false; }
+
+    return linkNodes();
+  }
+
   /**
    * Adds an existing object to the root or child node vectors depending on the
    * type of node to be added.
@@ -287,8 +517,8 @@ namespace sutil
    * in the passed arg_node2add
    * Passed: node to add, its index name and whether it is a root.
    */
-  template <typename TIdx, typename TNode>
-  TNode* CMappedTree<TIdx,TNode>::insert(
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  TNode* CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::insert(
       const TIdx& arg_idx, TNode *arg_node2add,
       const bool arg_is_root_)
   {
@@ -300,8 +530,8 @@ namespace sutil
       return NULL;
     }
 
-    //Add the node.
-    TNode* tLnk = sutil::CMappedList<TIdx,TNode>::create(arg_idx,arg_node2add);
+    //Add the node (the mapped list takes ownership of the passed pointer).
+    TNode* tLnk = sutil::CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::insert(arg_idx,arg_node2add);
 
     if((arg_is_root_) && (root_node_==NULL))
     { root_node_ = tLnk;  }
@@ -316,16 +546,16 @@ namespace sutil
    *
    * O(n*log(n))
    */
-  template <typename TIdx, typename TNode>
-  bool CMappedTree<TIdx,TNode>::linkNodes()
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::linkNodes()
   {
     if(NULL == getRootNodeConst())
     { return false; }
 
     //Clear previous links (if any)
-    typename CMappedList<TIdx,TNode>::iterator it,ite;
-    for(it = CMappedList<TIdx,TNode>::begin(),
-        ite = CMappedList<TIdx,TNode>::end();
+    typename CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::iterator it,ite;
+    for(it = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(),
+        ite = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end();
         it != ite; ++it)
     {
       TNode& tmp_node = *it;
@@ -334,8 +564,8 @@ namespace sutil
     }
 
     //Form the new links
-    for(it = CMappedList<TIdx,TNode>::begin(),
-        ite = CMappedList<TIdx,TNode>::end();
+    for(it = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::begin(),
+        ite = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::end();
         it != ite; ++it)
     {
       TNode& tmp_node = *it;
@@ -349,7 +579,7 @@ namespace sutil
       else
       {
         tmp_node.parent_addr_ =
-            sutil::CMappedList<TIdx,TNode>::at(tmp_node.parent_name_);
+            sutil::CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::at(tmp_node.parent_name_);
         if(tmp_node.parent_addr_ == NULL)
         {//No parent -- Ignore this node
 #ifdef DEBUG
@@ -372,14 +602,14 @@ namespace sutil
 
 
   /** Determines if the child has the other node as an ancestor */
-  template <typename TIdx, typename TNode>
-  bool CMappedTree<TIdx,TNode>::isAncestor(const TIdx& arg_idx_child,
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::isAncestor(const TIdx& arg_idx_child,
       const TIdx& arg_idx_ancestor) const
   { return isAncestor(this->at_const(arg_idx_child), this->at_const(arg_idx_child));  }
 
   /** Determines if the child has the other node as an ancestor */
-  template <typename TIdx, typename TNode>
-    bool CMappedTree<TIdx,TNode>::isAncestor(const TNode* arg_node_child,
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+    bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::isAncestor(const TNode* arg_node_child,
       const TNode* arg_node_ancestor)  const
   {
     const TNode *child = arg_node_child;
@@ -396,14 +626,14 @@ namespace sutil
   }
 
   /** Determines if the parent has the other node as a descendant */
-  template <typename TIdx, typename TNode>
-  bool CMappedTree<TIdx,TNode>::isDescendant(const TIdx& arg_idx_parent,
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::isDescendant(const TIdx& arg_idx_parent,
       const TIdx& arg_idx_descendant) const
   { return isDescendant(this->at_const(arg_idx_parent), this->at_const(arg_idx_descendant)); }
 
   /** Determines if the parent has the other node as a descendant */
-  template <typename TIdx, typename TNode>
-  bool CMappedTree<TIdx,TNode>::isDescendant(const TNode* arg_node_parent,
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::isDescendant(const TNode* arg_node_parent,
       const TNode* arg_node_descendant)  const
   {
     const TNode *parent = arg_node_parent;
@@ -426,10 +656,10 @@ namespace sutil
   }
 
   /** Clears all elements from the tree */
-  template <typename TIdx, typename TNode>
-  bool CMappedTree<TIdx,TNode>::clear()
+  template <typename TIdx, typename TNode, typename Alloc, typename Index, typename Stats, typename Rank, typename NodeTable>
+  bool CMappedTree<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::clear()
   {
-    bool flag = CMappedList<TIdx,TNode>::clear();
+    bool flag = CMappedList<TIdx,TNode,Alloc,Index,Stats,Rank,NodeTable>::clear();
     if(flag)
     {
       root_node_ = NULL;
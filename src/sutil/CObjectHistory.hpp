@@ -15,6 +15,8 @@ See the Readme.txt file in the root folder for licensing information.
 #include <sutil/CMappedList.hpp>
 #include <sutil/CSystemClock.hpp>
 
+#include <utility>
+
 #ifdef DEBUG
 #include <iostream>
 #endif
@@ -59,33 +61,55 @@ namespace sutil
       CMappedList<double, StoreObjectsAs>
     > data_;
 
-  public:
-    /** Saves the current state of an object (can be retrieved later) */
-    bool saveObject(const Idx& arg_idx, const StoreObjectsAs& arg_obj)
+    /** Returns an object's time series (creates it if required) */
+    CMappedList<double, StoreObjectsAs>* getObjectList(const Idx& arg_idx)
     {
-      bool flag;
       CMappedList<double, StoreObjectsAs>* objl = data_.at(arg_idx);
       if(NULL == objl)
       {
-        flag = data_.create(arg_idx);
-        if(false == flag)
+        objl = data_.create(arg_idx);
+        if(NULL == objl)
         {
 #ifdef DEBUG
           std::cerr<<"\nCObjectHistory::addObject() : Could not create an entry for this object";
 #endif
-          return false;
+          return NULL;
         }
-        objl = data_.at(arg_idx);
-        if(NULL == objl)
-        {
+      }
+      return objl;
+    }
+
+  public:
+    /** Iterates over an object's saved states, oldest first (!it is
+     * the time at which a state was saved) */
+    typedef typename CMappedList<double, StoreObjectsAs>::template key_const_iterator<> time_iterator;
+
+    /** Saves the current state of an object (can be retrieved later) */
+    bool saveObject(const Idx& arg_idx, const StoreObjectsAs& arg_obj)
+    {
+      CMappedList<double, StoreObjectsAs>* objl = getObjectList(arg_idx);
+      if(NULL == objl) { return false; }
+
+      bool flag = objl->create(CSystemClock::getSysTime(), arg_obj);//Stores objects at the start
+      if(false == flag)
+      {
 #ifdef DEBUG
-          std::cerr<<"\nCObjectHistory::addObject() : Created an entry for this object but can't access it. Invalid state.";
+        std::cerr<<"\nCObjectHistory::addObject() : Could not timestamp and store this object";
 #endif
-          return false;
-        }
+        return false;
       }
 
-      flag = objl->create(CSystemClock::getSysTime(), arg_obj);//Stores objects at the start
+      return true;
+    }
+
+    /** Saves an object by moving it into the history (no copies).
+     * Use this if you built the object just to save it. */
+    bool saveObject(const Idx& arg_idx, StoreObjectsAs&& arg_obj)
+    {
+      CMappedList<double, StoreObjectsAs>* objl = getObjectList(arg_idx);
+      if(NULL == objl) { return false; }
+
+      bool flag = objl->create(CSystemClock::getSysTime(), std::move(arg_obj));//Stores objects at the start
       if(false == flag)
       {
 #ifdef DEBUG
@@ -122,6 +146,37 @@ namespace sutil
       { return objl->at( std::size_t(0) );  }
     }
 
+    /** Retrieves the last state an object had at a point in time (the
+     * one saved at, or most recently before, arg_time). O(log n).
+     * Returns NULL if nothing was saved by then. */
+    const StoreObjectsAs* getObjectAtOrBefore(const Idx& arg_idx, double arg_time)
+    {
+      const CMappedList<double, StoreObjectsAs>* objl = data_.at(arg_idx);
+      if(NULL == objl) { return NULL; }
+      time_iterator it = objl->upper_bound(arg_time);
+      if(it == objl->key_begin()) { return NULL; }
+      --it;
+      return &(*it);
+    }
+
+    /** Retrieves the states an object was saved in between two points in
+     * time (inclusive), oldest first, without copying them. O(log n).
+     * Returns false if the object has no history.
+     *
+     * Usage:
+     *   sutil::CObjectHistory<std::string,SState>::time_iterator it,ite;
+     *   if(hist.getObjectsBetween("arm", t0, t1, it, ite))
+     *   for(; it!=ite; ++it) { std::cout<<"\n"<<!it<<" : "<<it->q_; } */
+    bool getObjectsBetween(const Idx& arg_idx, double arg_t0, double arg_t1,
+        time_iterator& ret_begin, time_iterator& ret_end)
+    {
+      const CMappedList<double, StoreObjectsAs>* objl = data_.at(arg_idx);
+      if(NULL == objl) { return false; }
+      ret_begin = objl->lower_bound(arg_t0);
+      ret_end = (arg_t1 < arg_t0) ? ret_begin : objl->upper_bound(arg_t1);
+      return true;
+    }
+
     /** Pointer deletion requires knowing the type. The Idx
      * and StoreObjectsAsdestructors should work. */
     bool removeObjectTimeSeries(const Idx& arg_idx)
@@ -18,6 +18,7 @@ See the Readme.txt file in the root folder for licensing information.
 #include <sys/types.h>
 
 #include <stdio.h>
+#include <cstddef>
 
 namespace sutil
 {
@@ -44,8 +45,20 @@ namespace sutil
    *   Use    : *shmem.data_
    *   Signal : *shmem.data_signal_
    *   Close  : shmDetach()
+   *
+   * The segment layout :
+   * (a) AlignData = false (default) : The original layout. The data
+   *     starts sizeof(SignalType) SignalTypes after the signal, and the
+   *     segment is sizeof(MemType)+sizeof(SignalType) bytes. Programs
+   *     built with earlier versions of this class use it.
+   * (b) AlignData = true : The data starts at the first multiple of
+   *     alignof(MemType) after the signal, and the segment is sized to
+   *     fit. Use it for a MemType that must be aligned (doubles, a
+   *     CMappedListShared etc.).
+   *
+   * NOTE : The server and its clients must use the same layout.
    *  */
-  template<typename MemType, typename SignalType>
+  template<typename MemType, typename SignalType, bool AlignData = false>
   class CSharedMemory
   {
   public:
@@ -64,7 +77,7 @@ namespace sutil
 
       //Get the shared memory {MemType, SignalType}. The SignalType is for signaling.
       //IPC_CREAT creates the mem, and 0666 sets a+rw access
-      shmem_id_ = shmget(key_, sizeof(MemType)+sizeof(SignalType), IPC_CREAT | 0666);
+      shmem_id_ = shmget(key_, segmentSize(), IPC_CREAT | 0666);
       if (shmem_id_ < 0)
       {
         perror("CSharedMemory::create() : Error: shmget could not create shared memory");
@@ -81,7 +94,7 @@ namespace sutil
       }
 
       data_signal_ = reinterpret_cast<SignalType*>(shmem);
-      data_ = reinterpret_cast<MemType*>(data_signal_+sizeof(SignalType));
+      data_ = reinterpret_cast<MemType*>(static_cast<char*>(shmem)+dataOffset());
 
       //Server initialized
       has_been_init_ = true;
@@ -98,7 +111,7 @@ namespace sutil
 
       //Get the shared memory {MemType, SignalType}. The SignalType is for signaling.
       //0666 sets a+rw access
-      shmem_id_ = shmget(key_, sizeof(MemType)+sizeof(SignalType), 0666);
+      shmem_id_ = shmget(key_, segmentSize(), 0666);
       if (shmem_id_ < 0)
       {
         perror("CSharedMemory::create() : Error: shmget could not create shared memory");
@@ -115,7 +128,7 @@ namespace sutil
       }
 
       data_signal_ = reinterpret_cast<SignalType*>(shmem);
-      data_ = reinterpret_cast<MemType*>(data_signal_+sizeof(SignalType));
+      data_ = reinterpret_cast<MemType*>(static_cast<char*>(shmem)+dataOffset());
 
       //Client initialized
       has_been_init_ = true;
@@ -181,6 +194,21 @@ namespace sutil
     SignalType data_terminate_;
 
   private:
+    /** Where the data starts (in bytes from the signal). The original
+     * layout steps sizeof(SignalType) SignalTypes past the signal. */
+    static std::size_t dataOffset()
+    {
+      if(false == AlignData) { return sizeof(SignalType)*sizeof(SignalType); }
+      return (sizeof(SignalType) + alignof(MemType) - 1) / alignof(MemType) * alignof(MemType);
+    }
+
+    /** The size of the segment (as requested from shmget) */
+    static std::size_t segmentSize()
+    {
+      if(false == AlignData) { return sizeof(MemType)+sizeof(SignalType); }
+      return dataOffset()+sizeof(MemType);
+    }
+
     int shmem_id_;
     key_t key_;
     bool has_been_init_;
@@ -0,0 +1,210 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CStaticMappedList.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CSTATICMAPPEDLIST_HPP_
+#define CSTATICMAPPEDLIST_HPP_
+
+#include <sutil/CMappedList.hpp>
+#include <sutil/CMappedListAllocInline.hpp>
+#include <sutil/CMappedListIndexSmall.hpp>
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifdef DEBUG
+#include <cassert>
+#endif
+
+namespace sutil
+{
+  /** A CMappedList allocation policy with room for exactly N nodes,
+   * stored inside the allocator (and so inside the list object). Each
+   * node holds its data and index (see SMLNodeInline).
+   *
+   * createNode() returns NULL once N nodes are in use. Nothing is ever
+   * allocated on the heap (except by adoptNode's caller).
+   *
+   * NOTE : The nodes can't change hands, so the allocator can't be
+   *        swapped. Swapping or moving a list that uses it (even through
+   *        a CMappedList&) doesn't compile. */
+  template <typename Idx, typename T, std::size_t N>
+  class CMappedListAllocFixed
+  {
+  public:
+    CMappedListAllocFixed() : nfree_(N)
+    {
+      //Hand out the blocks in order (so the first nodes are adjacent)
+      for(std::size_t i=0; i<N; ++i) { free_[i] = N-1-i; }
+    }
+
+    template <typename I, typename... Args>
+    SMLNode<Idx,T>* createNode(I&& arg_idx, Args&&... arg_args)
+    {
+      if(0 == nfree_) { return NULL; }
+      SMLNodeInline<Idx,T>* node = new(&blocks_[free_[--nfree_]]) SMLNodeInline<Idx,T>();
+      node->data_ = new(&node->data_store_) T(std::forward<Args>(arg_args)...);
+      node->id_ = new(&node->id_store_) Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    template <typename I>
+    SMLNode<Idx,T>* adoptNode(I&& arg_idx, T* arg_t)
+    {
+      if(0 == nfree_) { return NULL; }
+      SMLNodeInline<Idx,T>* node = new(&blocks_[free_[--nfree_]]) SMLNodeInline<Idx,T>();
+      node->data_ = arg_t;
+      node->id_ = new(&node->id_store_) Idx(std::forward<I>(arg_idx));
+      return node;
+    }
+
+    void destroyNode(SMLNode<Idx,T>* arg_node)
+    {
+      SMLNodeInline<Idx,T>* node = static_cast<SMLNodeInline<Idx,T>*>(arg_node);
+      if(NULL != node->data_)
+      {
+        if(node->isDataInline())
+        { node->data_->~T();  }
+        else
+        { delete node->data_; }
+      }
+      if(NULL != node->id_)
+      { node->id_->~Idx(); }
+      node->~SMLNodeInline<Idx,T>();
+      free_[nfree_++] = static_cast<std::size_t>(
+          reinterpret_cast<SBlock*>(node) - blocks_);
+    }
+
+    /** The nodes live inside the allocator, so a CMappedList that uses
+     * it can't be swapped or moved (instantiating those uses this). */
+    void swap(CMappedListAllocFixed<Idx,T,N>& arg_swap_obj) = delete;
+
+    /** All the memory is already here. Nothing to do. */
+    void reserve(const std::size_t arg_n) {}
+
+    /** The number of live nodes */
+    std::size_t getNumNodes() const
+    { return N - nfree_; }
+
+    /** The number of nodes that can still be created */
+    std::size_t getNumFree() const
+    { return nfree_; }
+
+  private:
+    typedef typename std::aligned_storage<sizeof(SMLNodeInline<Idx,T>),
+        alignof(SMLNodeInline<Idx,T>)>::type SBlock;
+
+    SBlock blocks_[N];
+    /** A stack of the free blocks' positions */
+    std::size_t free_[N];
+    std::size_t nfree_;
+
+    CMappedListAllocFixed(const CMappedListAllocFixed&);
+    CMappedListAllocFixed& operator = (const CMappedListAllocFixed&);
+  };
+
+  /** An index policy that holds nothing and refuses every insert. Use
+   * it as a CMappedListIndexSmall's Big index to cap the index at its
+   * inline array. */
+  template <typename Idx, typename T>
+  class CMappedListIndexNone
+  {
+  public:
+    SMLNode<Idx,T>* find(const Idx& arg_idx) const { return NULL; }
+    bool insert(const Idx& arg_idx, SMLNode<Idx,T>* arg_node) { return false; }
+    bool insertHinted(const Idx& arg_idx, SMLNode<Idx,T>* arg_node) { return false; }
+    bool erase(const Idx& arg_idx) { return false; }
+    void clear() {}
+    std::size_t size() const { return 0; }
+    void reserve(const std::size_t arg_n) {}
+    void swap(CMappedListIndexNone<Idx,T>& arg_swap_obj) {}
+
+    template <typename Remap>
+    bool cloneFrom(const CMappedListIndexNone<Idx,T>& arg_src, const Remap& arg_remap)
+    { return true; }
+  };
+
+  /** A mapped list with room for N elements that never touches the heap
+   * after it is constructed. For real-time threads that mustn't call
+   * malloc.
+   *
+   * The nodes (with their data and Idx) live inside the list object,
+   * and the Idx lookups use an inline array (see CMappedListIndexSmall).
+   * The list's pointer table and position cache are sized for N when
+   * the list is constructed.
+   *
+   * create() returns NULL when the list is full. Pointers to elements
+   * stay valid until they are erased, and the iterators are the same as
+   * a CMappedList's.
+   *
+   * Idx lookups search the inline array (O(N), but with no pointer
+   * chasing). For larger N pass a CMappedListIndexHash as the Index;
+   * it is also reserved for N up front, so it doesn't allocate either.
+   *
+   * Usage:
+   *   sutil::CStaticMappedList<std::string, SSensor, 32> sensors; //At init
+   *   ...
+   *   SSensor* s = sensors.create("ft_wrist"); //In the control loop. No malloc.
+   *   if(NULL == s) { ... } //Full
+   *
+   * NOTE : These still allocate (call them during initialization) :
+   *        copying, sort() and insert() (whose argument was new'd).
+   *        The list can't be moved or swapped, since its nodes live
+   *        inside it. A CMappedListRankFenwick Rank and a
+   *        CMappedListNodeTableHash allocate too (they grow with the
+   *        list). */
+  template <typename Idx, typename T, std::size_t N,
+            typename Index = CMappedListIndexSmall<Idx,T,N,CMappedListIndexNone<Idx,T> >,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<Idx,T>,
+            typename NodeTable = CMappedListNodeTableNone<Idx,T> >
+  class CStaticMappedList :
+      public CMappedList<Idx,T,CMappedListAllocFixed<Idx,T,N>,Index,Stats,Rank,NodeTable>
+  {
+    typedef CMappedList<Idx,T,CMappedListAllocFixed<Idx,T,N>,Index,Stats,Rank,NodeTable> base;
+  public:
+    CStaticMappedList() : base()
+    { base::reserve(N); }
+
+    /** Copy Constructor : Performs a deep-copy (allocates temporaries) */
+    explicit CStaticMappedList(const CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>& arg_sl) : base()
+    {
+      base::reserve(N);
+      base::deepCopy(&arg_sl);
+    }
+
+    /** Assignment operator : Performs a deep-copy (allocates temporaries) */
+    CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>& operator = (const CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>& arg_rhs)
+    {
+      base::deepCopy(&arg_rhs);
+      return *this;
+    }
+
+    /** The nodes live inside the list. They can't be handed over. */
+    CStaticMappedList(CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>&& arg_sl) = delete;
+    CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>& operator = (CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>&& arg_rhs) = delete;
+    void swap(CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>& arg_swap_obj) = delete;
+
+    virtual ~CStaticMappedList() {}
+
+    /** The number of elements the list can hold */
+    std::size_t capacity() const
+    { return N; }
+
+    /** Whether create() will fail */
+    bool full() const
+    { return N == base::size(); }
+  };
+
+}//End of namespace sutil
+
+#endif /*CSTATICMAPPEDLIST_HPP_*/
@@ -0,0 +1,269 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CStaticMappedMultiLevelList.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CSTATICMAPPEDMULTILEVELLIST_HPP_
+#define CSTATICMAPPEDMULTILEVELLIST_HPP_
+
+#include <sutil/CStaticMappedList.hpp>
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+
+namespace sutil
+{
+  /** A multi level mapped list (see CMappedMultiLevelList) with room
+   * for N elements in P priority levels, that never touches the heap
+   * after it is constructed.
+   *
+   * The elements are stored as in a CStaticMappedList. The levels share
+   * one inline array of N pointers, ordered by level (level 0 first), so
+   * a level is a contiguous [begin, end) range of that array.
+   *
+   * create() returns NULL when the list is full or the priority is P or
+   * more. Creating and erasing are O(N) (the array is shifted, like the
+   * erase in a CMappedMultiLevelList's level vectors). Use erase_if or
+   * the key range erase to erase k elements in O(N log k) (plus one Idx
+   * lookup per key for the range erase).
+   *
+   * Usage:
+   *   sutil::CStaticMappedMultiLevelList<std::string, STask, 32, 4> tasks;
+   *   tasks.create("posture", 2);
+   *   std::size_t n;
+   *   STask* const* level = tasks.getSinglePriorityLevel(2, n);
+   *   for(std::size_t i=0; i<n; ++i) { level[i]->compute(); }
+   *
+   * NOTE : Use the create functions that take a priority. The list
+   *        can't be copied, moved or swapped. */
+  template <typename Idx, typename T, std::size_t N, std::size_t P,
+            typename Index = CMappedListIndexSmall<Idx,T,N,CMappedListIndexNone<Idx,T> >,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<Idx,T>,
+            typename NodeTable = CMappedListNodeTableNone<Idx,T> >
+  class CStaticMappedMultiLevelList : public CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable>
+  {
+    typedef CStaticMappedList<Idx,T,N,Index,Stats,Rank,NodeTable> base;
+    typedef CMappedList<Idx,T,CMappedListAllocFixed<Idx,T,N>,Index,Stats,Rank,NodeTable> list;
+  public:
+    CStaticMappedMultiLevelList() : base(), pri_levels_(0)
+    { for(std::size_t i=0; i<P; ++i) { level_end_[i] = 0; } }
+
+    /** The levels point into this list's nodes. Copy with create(). */
+    CStaticMappedMultiLevelList(const CStaticMappedMultiLevelList<Idx,T,N,P,Index,Stats,Rank,NodeTable>& arg_ml) = delete;
+    CStaticMappedMultiLevelList<Idx,T,N,P,Index,Stats,Rank,NodeTable>& operator = (const CStaticMappedMultiLevelList<Idx,T,N,P,Index,Stats,Rank,NodeTable>& arg_rhs) = delete;
+
+    virtual ~CStaticMappedMultiLevelList() {}
+
+    /** Default constructs an element at the given priority level */
+    virtual T* create(const Idx& arg_idx, const std::size_t arg_priority)
+    {
+      if(arg_priority >= P) { return NULL; }
+      return addToLevel(list::create(arg_idx, false), arg_priority);
+    }
+
+    /** Copies an element in at the given priority level */
+    virtual T* create(const Idx& arg_idx, const T& arg_node2add,
+        const std::size_t arg_priority)
+    {
+      if(arg_priority >= P) { return NULL; }
+      return addToLevel(list::create(arg_idx, arg_node2add, false), arg_priority);
+    }
+
+    /** Erases an element (and removes it from its level) */
+    virtual bool erase(const T* arg_t)
+    {
+      const int pos = findPos(arg_t);
+      if(0 > pos) { return false; }
+      removeFromLevels(static_cast<std::size_t>(pos));
+      return list::erase(arg_t);
+    }
+
+    /** Erases an element (and removes it from its level) */
+    virtual bool erase(const Idx& arg_idx)
+    {
+      T* t = list::at(arg_idx);
+      if(NULL == t) { return false; }
+      return erase(static_cast<const T*>(t));
+    }
+
+    /** Erases every element for which arg_pred(const T&) is true. Takes
+     * the victims out of the levels in one pass, then out of the list in
+     * one walk. O(N log k) for k victims. Returns the number erased. */
+    template <typename Pred>
+    std::size_t erase_if(Pred arg_pred)
+    {
+      std::size_t k = 0;
+      for(std::size_t i=0; i<level_end_[P-1]; ++i)
+      {
+        if(arg_pred(static_cast<const T&>(*elems_[i])))
+        { victims_[k++] = elems_[i]; elems_[i] = NULL; }
+      }
+      if(0 == k) { return 0; }
+      compactLevels();
+      return eraseVictims(k);
+    }
+
+    /** Erases the elements whose Idx is in [arg_first, arg_last) (and
+     * skips the keys that aren't in the list). Finds each by its Idx,
+     * then shifts the survivors back once and walks the list once.
+     * O(N log k) for k keys, plus k Idx lookups (each O(N) with the
+     * default small index). Returns the number erased. */
+    template <typename ForwardIt>
+    std::size_t erase(ForwardIt arg_first, ForwardIt arg_last)
+    {
+      std::size_t k = 0;
+      for(; arg_first != arg_last; ++arg_first)
+      {
+        T* t = list::at(*arg_first);
+        if(NULL == t) { continue; }
+        if(N == k)
+        {//Drop the repeated keys. If all N are victims, the rest are repeats.
+          k = uniqueVictims(k);
+          if(N == k) { break; }
+        }
+        victims_[k++] = t;
+      }
+      if(0 == k) { return 0; }
+      k = uniqueVictims(k);
+
+      for(std::size_t i=0; i<level_end_[P-1]; ++i)
+      { if(std::binary_search(victims_, victims_+k, elems_[i], std::less<T*>())) { elems_[i] = NULL; } }
+      compactLevels();
+      return eraseVictims(k);
+    }
+
+    /** Clears all elements from the list and its levels */
+    virtual bool clear()
+    {
+      list::clear();
+      for(std::size_t i=0; i<P; ++i) { level_end_[i] = 0; }
+      pri_levels_ = 0;
+      return true;
+    }
+
+    /** Returns the elements at a level (and their number in ret_size).
+     * Returns NULL if the priority is P or more. */
+    T* const* getSinglePriorityLevel(const std::size_t arg_pri, std::size_t& ret_size) const
+    {
+      if(arg_pri >= P) { ret_size = 0; return NULL; }
+      const std::size_t b = (0 == arg_pri) ? 0 : level_end_[arg_pri-1];
+      ret_size = level_end_[arg_pri] - b;
+      return elems_ + b;
+    }
+
+    /** The number of levels up to (and including) the last non-empty one */
+    std::size_t getNumPriorityLevels() const
+    { return pri_levels_; }
+
+    /** Returns the priority level of the element (-1 if it isn't here) */
+    int getPriorityLevel(const T* arg_t) const
+    {
+      const int pos = findPos(arg_t);
+      if(0 > pos) { return -1; }
+      std::size_t p = 0;
+      while(static_cast<std::size_t>(pos) >= level_end_[p]) { p++; }
+      return static_cast<int>(p);
+    }
+
+    /** Returns the priority level of the element (-1 if it isn't here) */
+    int getPriorityLevel(const Idx& arg_idx) const
+    { return getPriorityLevel(list::at_const(arg_idx)); }
+
+  private:
+    /** Inserts arg_t at the end of its level (shifting the later levels) */
+    T* addToLevel(T* arg_t, const std::size_t arg_pri)
+    {
+      if(NULL == arg_t) { return NULL; }
+      for(std::size_t i = level_end_[P-1]; i > level_end_[arg_pri]; --i)
+      { elems_[i] = elems_[i-1]; }
+      elems_[level_end_[arg_pri]] = arg_t;
+      for(std::size_t p = arg_pri; p<P; ++p) { level_end_[p]++; }
+      if(arg_pri >= pri_levels_) { pri_levels_ = arg_pri+1; }
+      return arg_t;
+    }
+
+    /** Removes the element at arg_pos (shifting the later levels back) */
+    void removeFromLevels(const std::size_t arg_pos)
+    {
+      for(std::size_t i = arg_pos+1; i < level_end_[P-1]; ++i)
+      { elems_[i-1] = elems_[i]; }
+      for(std::size_t p = 0; p<P; ++p)
+      { if(level_end_[p] > arg_pos) { level_end_[p]--; } }
+      dropEmptyLevels();
+    }
+
+    /** Removes the NULL (erased) elements, shifting each survivor back
+     * once, and updates the level ends */
+    void compactLevels()
+    {
+      std::size_t i = 0, w = 0;
+      for(std::size_t p = 0; p<P; ++p)
+      {
+        for(; i < level_end_[p]; ++i)
+        { if(NULL != elems_[i]) { elems_[w++] = elems_[i]; } }
+        level_end_[p] = w;
+      }
+      dropEmptyLevels();
+    }
+
+    /** Sorts the first arg_k victims and drops the repeats. Returns
+     * how many are left. */
+    std::size_t uniqueVictims(const std::size_t arg_k)
+    {
+      std::sort(victims_, victims_+arg_k, std::less<T*>());
+      return static_cast<std::size_t>(std::unique(victims_, victims_+arg_k) - victims_);
+    }
+
+    /** Erases the first arg_k victims (which must be unique and out of
+     * the levels already) from the list, in one walk that also keeps the
+     * sort order. Doesn't allocate. Returns the number erased. */
+    std::size_t eraseVictims(const std::size_t arg_k)
+    {
+      std::sort(victims_, victims_+arg_k, std::less<T*>());
+      T* const* vb = victims_;
+      T* const* ve = victims_+arg_k;
+      return list::erase_if([vb, ve](const T& arg_t)
+          { return std::binary_search(vb, ve, const_cast<T*>(&arg_t), std::less<T*>()); });
+    }
+
+    /** Drops the empty levels at the end */
+    void dropEmptyLevels()
+    {
+      while(0 < pri_levels_ &&
+          (1 == pri_levels_ ? 0 : level_end_[pri_levels_-2]) == level_end_[pri_levels_-1])
+      { pri_levels_--; }
+    }
+
+    /** The position of an element in elems_ (-1 if absent) */
+    int findPos(const T* arg_t) const
+    {
+      if(NULL == arg_t) { return -1; }
+      for(std::size_t i=0; i<level_end_[P-1]; ++i)
+      { if(elems_[i] == arg_t) { return static_cast<int>(i); } }
+      return -1;
+    }
+
+    /** The elements, ordered by level */
+    T* elems_[N];
+
+    /** Scratch space for the batched erases (so they don't allocate) */
+    T* victims_[N];
+
+    /** Level p is elems_[level_end_[p-1], level_end_[p]) */
+    std::size_t level_end_[P];
+
+    /** The levels this multi-level list has (see getNumPriorityLevels) */
+    std::size_t pri_levels_;
+  };
+
+}//End of namespace sutil
+
+#endif /*CSTATICMAPPEDMULTILEVELLIST_HPP_*/
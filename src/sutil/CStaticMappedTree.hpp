@@ -0,0 +1,82 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CStaticMappedTree.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CSTATICMAPPEDTREE_HPP_
+#define CSTATICMAPPEDTREE_HPP_
+
+#include <sutil/CMappedTree.hpp>
+#include <sutil/CStaticMappedList.hpp>
+
+#include <cstddef>
+
+namespace sutil
+{
+  /** A mapped tree with room for N nodes, stored inside the tree object
+   * (see CStaticMappedList). create() returns NULL when the tree is
+   * full, and creating, erasing, looking up and iterating over nodes
+   * never touches the heap.
+   *
+   * Usage:
+   *   //The static tree's nodes are incomplete here (it stores them), so
+   *   //use a CMappedTree's node base (the tree only uses its members).
+   *   struct SLink : public sutil::CMappedTree<std::string,SLink>::SMTNodeBase
+   *   { ... };
+   *   sutil::CStaticMappedTree<std::string,SLink,64> robot;
+   *
+   * NOTE : linkNodes() fills each node's child_addrs_ (a std::vector),
+   *        so link the tree during initialization. Copying allocates
+   *        too. The tree can't be moved or swapped. */
+  template <typename TIdx, typename TNode, std::size_t N,
+            typename Index = CMappedListIndexSmall<TIdx,TNode,N,CMappedListIndexNone<TIdx,TNode> >,
+            typename Stats = CMappedListStatsNone,
+            typename Rank = CMappedListRankNone<TIdx,TNode>,
+            typename NodeTable = CMappedListNodeTableNone<TIdx,TNode> >
+  class CStaticMappedTree :
+      public CMappedTree<TIdx,TNode,CMappedListAllocFixed<TIdx,TNode,N>,Index,Stats,Rank,NodeTable>
+  {
+    typedef CMappedTree<TIdx,TNode,CMappedListAllocFixed<TIdx,TNode,N>,Index,Stats,Rank,NodeTable> base;
+  public:
+    CStaticMappedTree() : base()
+    { base::reserve(N); }
+
+    /** Copy Constructor : Performs a deep-copy (allocates temporaries) */
+    explicit CStaticMappedTree(const CStaticMappedTree<TIdx,TNode,N,Index,Stats,Rank,NodeTable>& arg_st) : base()
+    {
+      base::reserve(N);
+      base::deepCopy(&arg_st);
+    }
+
+    /** Assignment operator : Performs a deep-copy (allocates temporaries) */
+    CStaticMappedTree<TIdx,TNode,N,Index,Stats,Rank,NodeTable>& operator = (const CStaticMappedTree<TIdx,TNode,N,Index,Stats,Rank,NodeTable>& arg_rhs)
+    {
+      base::deepCopy(&arg_rhs);
+      return *this;
+    }
+
+    /** The nodes live inside the tree. They can't be handed over. */
+    CStaticMappedTree(CStaticMappedTree<TIdx,TNode,N,Index,Stats,Rank,NodeTable>&& arg_st) = delete;
+    CStaticMappedTree<TIdx,TNode,N,Index,Stats,Rank,NodeTable>& operator = (CStaticMappedTree<TIdx,TNode,N,Index,Stats,Rank,NodeTable>&& arg_rhs) = delete;
+    void swap(CStaticMappedTree<TIdx,TNode,N,Index,Stats,Rank,NodeTable>& arg_swap_obj) = delete;
+
+    virtual ~CStaticMappedTree() {}
+
+    /** The number of nodes the tree can hold */
+    std::size_t capacity() const
+    { return N; }
+
+    /** Whether create() will fail */
+    bool full() const
+    { return N == base::size(); }
+  };
+
+}//End of namespace sutil
+
+#endif /*CSTATICMAPPEDTREE_HPP_*/
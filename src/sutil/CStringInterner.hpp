@@ -0,0 +1,183 @@
+/* This file is part of sUtil, a random collection of utilities.
+
+See the Readme.txt file in the root folder for licensing information.
+ */
+/* \file CStringInterner.hpp
+ *
+ *  Created on: Oct 16, 2026
+ *
+ *  Copyright (C) 2026, Samir Menon <smenon@stanford.edu>
+ */
+
+#ifndef CSTRINGINTERNER_HPP_
+#define CSTRINGINTERNER_HPP_
+
+#include <sutil/CSingleton.hpp>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <ostream>
+#include <cstddef>
+
+namespace sutil
+{
+  /** Maps strings to dense integer ids (0, 1, 2...), once. Each string
+   * gets the next free id the first time it is interned, and keeps it
+   * until the table is cleared.
+   *
+   * Id 0 is always the empty string.
+   *
+   * Usage:
+   *   sutil::CStringInterner names;
+   *   sutil::CStringInterner::id_type shoulder = names.intern("shoulder");
+   *   const std::string* s = names.name(shoulder); // "shoulder"
+   *
+   * NOTE : Interning isn't thread safe. Intern the names during
+   *        initialization; looking them up later only reads. */
+  class CStringInterner
+  {
+  public:
+    typedef unsigned int id_type;
+
+    CStringInterner()
+    { intern(std::string()); }
+
+    /** Returns the string's id (giving it the next one if it is new) */
+    id_type intern(const std::string& arg_str)
+    {
+      std::unordered_map<std::string,id_type>::const_iterator it = ids_.find(arg_str);
+      if(it != ids_.end()) { return it->second; }
+      const id_type id = static_cast<id_type>(names_.size());
+      it = ids_.insert(std::make_pair(arg_str,id)).first;
+      //The map's nodes don't move when it rehashes, so the key stays put
+      names_.push_back(&(it->first));
+      return id;
+    }
+
+    /** Finds the string's id. Returns false if it was never interned. */
+    bool find(const std::string& arg_str, id_type& ret_id) const
+    {
+      std::unordered_map<std::string,id_type>::const_iterator it = ids_.find(arg_str);
+      if(it == ids_.end()) { return false; }
+      ret_id = it->second;
+      return true;
+    }
+
+    /** The string with the passed id. NULL if no string has it. */
+    const std::string* name(const id_type arg_id) const
+    {
+      if(arg_id >= names_.size()) { return NULL; }
+      return names_[arg_id];
+    }
+
+    /** The number of strings (and ids) in the table */
+    std::size_t size() const
+    { return names_.size(); }
+
+    /** Makes room for n strings */
+    void reserve(const std::size_t arg_n)
+    { ids_.reserve(arg_n); names_.reserve(arg_n); }
+
+    /** Forgets all the strings (except the empty one). The old ids will
+     * be handed out again, to different strings. */
+    void clear()
+    {
+      ids_.clear(); names_.clear();
+      intern(std::string());
+    }
+
+  private:
+    /** The string to id map */
+    std::unordered_map<std::string,id_type> ids_;
+    /** The id to string map (points at the keys in ids_) */
+    std::vector<const std::string*> names_;
+
+    CStringInterner(const CStringInterner&);
+    CStringInterner& operator = (const CStringInterner&);
+  };
+
+  /** The process-wide string table that SInternedStrings use. */
+  typedef sutil::CSingleton<CStringInterner> CRegisteredStrings;
+
+  /** A string key that is stored, hashed and compared as its integer id
+   * in the CRegisteredStrings table. Use it in place of std::string as
+   * a container's Idx, so that tree and graph linking and registry
+   * lookups compare integers in the hot path.
+   *
+   * Constructing one from a string interns it (a hash lookup), so make
+   * the keys once (eg. when loading a model) and reuse them.
+   *
+   * Usage:
+   *   struct SLink : public sutil::CMappedTree<sutil::SInternedString,SLink>::SMTNodeBase
+   *   { ... };
+   *   sutil::CMappedTree<sutil::SInternedString,SLink> robot;
+   *   SLink* l = robot.create("shoulder", false); //Interns "shoulder"
+   *   l->parent_name_ = "root";
+   *
+   *   //O(1) lookups with no hashing at all (the id is the position)
+   *   sutil::CMappedTree<sutil::SInternedString,SLink,
+   *     sutil::CMappedListAllocNew<sutil::SInternedString,SLink>,
+   *     sutil::CMappedListIndexDense<sutil::SInternedString,SLink> > fast_robot;
+   *
+   * NOTE : Keys are ordered by id (the order they were first interned),
+   *        not alphabetically. Resetting the CRegisteredStrings table
+   *        invalidates all the keys. */
+  struct SInternedString
+  {
+  public:
+    /** The empty string */
+    SInternedString() : id_(0) {}
+
+    SInternedString(const std::string& arg_str) :
+      id_(arg_str.empty() ? 0 : CRegisteredStrings::getData()->intern(arg_str)) {}
+
+    /** A NULL string is the empty string */
+    SInternedString(const char* arg_str) :
+      id_((NULL == arg_str || '\0' == arg_str[0]) ? 0 : CRegisteredStrings::getData()->intern(arg_str)) {}
+
+    /** The interned string */
+    const std::string& str() const
+    { return *(CRegisteredStrings::getData()->name(id_)); }
+
+    /** The string's id in the CRegisteredStrings table */
+    CStringInterner::id_type id() const
+    { return id_; }
+
+    /** The id (so the key can index arrays, see CMappedListIndexDense) */
+    explicit operator std::size_t() const
+    { return id_; }
+
+    bool operator == (const SInternedString& arg_rhs) const
+    { return id_ == arg_rhs.id_; }
+
+    bool operator != (const SInternedString& arg_rhs) const
+    { return id_ != arg_rhs.id_; }
+
+    /** Orders by id (not alphabetically) */
+    bool operator < (const SInternedString& arg_rhs) const
+    { return id_ < arg_rhs.id_; }
+
+  private:
+    CStringInterner::id_type id_;
+  };
+
+  /** Prints the string (not the id) */
+  inline std::ostream& operator << (std::ostream& arg_os, const SInternedString& arg_str)
+  { return arg_os<<arg_str.str(); }
+
+}//End of namespace sutil
+
+namespace std
+{
+  /** Hashes the id (so hash indices don't touch the string) */
+  template <>
+  struct hash<sutil::SInternedString>
+  {
+    std::size_t operator()(const sutil::SInternedString& arg_str) const
+    { return static_cast<std::size_t>(arg_str.id()); }
+  };
+}
+
+#endif /*CSTRINGINTERNER_HPP_*/